@@ -39,6 +39,11 @@
 #include <plant/stochastic_patch.h>
 #include <plant/stochastic_patch_runner.h>
 
+// Mesh model
+#include <plant/mesh_species.h>
+#include <plant/mesh_patch.h>
+#include <plant/mesh_scm.h>
+
 #include <plant/plant_runner.h>
 
 // Purely for testing
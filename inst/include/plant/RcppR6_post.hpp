@@ -145,6 +145,13 @@ template <> inline std::string generator_name<plant::StochasticPatchRunner<plant
 template <> inline std::string   class_name_r<plant::StochasticPatchRunner<plant::FF16r_Strategy> >() {return "StochasticPatchRunner<FF16r>";}
 template <> inline std::string   package_name<plant::StochasticPatchRunner<plant::FF16r_Strategy> >() {return "plant";}
 template <> inline std::string generator_name<plant::StochasticPatchRunner<plant::FF16r_Strategy> >() {return ".R6_StochasticPatchRunner___FF16r";}
+template <> inline std::string   class_name_r<plant::MeshSCM<plant::FF16_Strategy> >() {return "MeshSCM<FF16>";}
+template <> inline std::string   package_name<plant::MeshSCM<plant::FF16_Strategy> >() {return "plant";}
+template <> inline std::string generator_name<plant::MeshSCM<plant::FF16_Strategy> >() {return ".R6_MeshSCM___FF16";}
+
+template <> inline std::string   class_name_r<plant::MeshSCM<plant::FF16r_Strategy> >() {return "MeshSCM<FF16r>";}
+template <> inline std::string   package_name<plant::MeshSCM<plant::FF16r_Strategy> >() {return "plant";}
+template <> inline std::string generator_name<plant::MeshSCM<plant::FF16r_Strategy> >() {return ".R6_MeshSCM___FF16r";}
 }
 }
 }
@@ -230,16 +237,24 @@ template <> inline SEXP wrap(const plant::Control& x) {
   ret["plant_assimilation_tol"] = Rcpp::wrap(x.plant_assimilation_tol);
   ret["plant_assimilation_iterations"] = Rcpp::wrap(x.plant_assimilation_iterations);
   ret["plant_assimilation_rule"] = Rcpp::wrap(x.plant_assimilation_rule);
+  ret["plant_assimilation_knots"] = Rcpp::wrap(x.plant_assimilation_knots);
+  ret["plant_assimilation_knots_width"] = Rcpp::wrap(x.plant_assimilation_knots_width);
+  ret["plant_assimilation_tol_weight_max"] = Rcpp::wrap(x.plant_assimilation_tol_weight_max);
   ret["plant_seed_tol"] = Rcpp::wrap(x.plant_seed_tol);
   ret["plant_seed_iterations"] = Rcpp::wrap(x.plant_seed_iterations);
   ret["cohort_gradient_eps"] = Rcpp::wrap(x.cohort_gradient_eps);
   ret["cohort_gradient_direction"] = Rcpp::wrap(x.cohort_gradient_direction);
   ret["cohort_gradient_richardson"] = Rcpp::wrap(x.cohort_gradient_richardson);
   ret["cohort_gradient_richardson_depth"] = Rcpp::wrap(x.cohort_gradient_richardson_depth);
+  ret["cohort_gradient_neighbour_gap"] = Rcpp::wrap(x.cohort_gradient_neighbour_gap);
+  ret["cohort_integration_cubic"] = Rcpp::wrap(x.cohort_integration_cubic);
   ret["environment_light_tol"] = Rcpp::wrap(x.environment_light_tol);
   ret["environment_light_nbase"] = Rcpp::wrap(x.environment_light_nbase);
   ret["environment_light_max_depth"] = Rcpp::wrap(x.environment_light_max_depth);
   ret["environment_light_rescale_usually"] = Rcpp::wrap(x.environment_light_rescale_usually);
+  ret["environment_light_reuse_tol"] = Rcpp::wrap(x.environment_light_reuse_tol);
+  ret["environment_light_monotone"] = Rcpp::wrap(x.environment_light_monotone);
+  ret["environment_light_leaf_area"] = Rcpp::wrap(x.environment_light_leaf_area);
   ret["ode_step_size_initial"] = Rcpp::wrap(x.ode_step_size_initial);
   ret["ode_step_size_min"] = Rcpp::wrap(x.ode_step_size_min);
   ret["ode_step_size_max"] = Rcpp::wrap(x.ode_step_size_max);
@@ -247,10 +262,16 @@ template <> inline SEXP wrap(const plant::Control& x) {
   ret["ode_tol_abs"] = Rcpp::wrap(x.ode_tol_abs);
   ret["ode_a_y"] = Rcpp::wrap(x.ode_a_y);
   ret["ode_a_dydt"] = Rcpp::wrap(x.ode_a_dydt);
+  ret["ode_step_size_pi"] = Rcpp::wrap(x.ode_step_size_pi);
+  ret["ode_step_size_estimate"] = Rcpp::wrap(x.ode_step_size_estimate);
   ret["schedule_nsteps"] = Rcpp::wrap(x.schedule_nsteps);
   ret["schedule_eps"] = Rcpp::wrap(x.schedule_eps);
   ret["schedule_verbose"] = Rcpp::wrap(x.schedule_verbose);
   ret["schedule_patch_survival"] = Rcpp::wrap(x.schedule_patch_survival);
+  ret["schedule_richardson"] = Rcpp::wrap(x.schedule_richardson);
+  ret["schedule_end_tol"] = Rcpp::wrap(x.schedule_end_tol);
+  ret["schedule_end_declines"] = Rcpp::wrap(x.schedule_end_declines);
+  ret["mesh_n_cells"] = Rcpp::wrap(x.mesh_n_cells);
   ret["equilibrium_nsteps"] = Rcpp::wrap(x.equilibrium_nsteps);
   ret["equilibrium_eps"] = Rcpp::wrap(x.equilibrium_eps);
   ret["equilibrium_large_seed_rain_change"] = Rcpp::wrap(x.equilibrium_large_seed_rain_change);
@@ -282,6 +303,12 @@ template <> inline plant::Control as(SEXP x) {
   ret.plant_assimilation_iterations = Rcpp::as<size_t >(xl["plant_assimilation_iterations"]);
   // ret.plant_assimilation_rule = Rcpp::as<decltype(retplant_assimilation_rule) >(xl["plant_assimilation_rule"]);
   ret.plant_assimilation_rule = Rcpp::as<size_t >(xl["plant_assimilation_rule"]);
+  // ret.plant_assimilation_knots = Rcpp::as<decltype(retplant_assimilation_knots) >(xl["plant_assimilation_knots"]);
+  ret.plant_assimilation_knots = Rcpp::as<size_t >(xl["plant_assimilation_knots"]);
+  // ret.plant_assimilation_knots_width = Rcpp::as<decltype(retplant_assimilation_knots_width) >(xl["plant_assimilation_knots_width"]);
+  ret.plant_assimilation_knots_width = Rcpp::as<double >(xl["plant_assimilation_knots_width"]);
+  // ret.plant_assimilation_tol_weight_max = Rcpp::as<decltype(retplant_assimilation_tol_weight_max) >(xl["plant_assimilation_tol_weight_max"]);
+  ret.plant_assimilation_tol_weight_max = Rcpp::as<double >(xl["plant_assimilation_tol_weight_max"]);
   // ret.plant_seed_tol = Rcpp::as<decltype(retplant_seed_tol) >(xl["plant_seed_tol"]);
   ret.plant_seed_tol = Rcpp::as<double >(xl["plant_seed_tol"]);
   // ret.plant_seed_iterations = Rcpp::as<decltype(retplant_seed_iterations) >(xl["plant_seed_iterations"]);
@@ -294,6 +321,10 @@ template <> inline plant::Control as(SEXP x) {
   ret.cohort_gradient_richardson = Rcpp::as<bool >(xl["cohort_gradient_richardson"]);
   // ret.cohort_gradient_richardson_depth = Rcpp::as<decltype(retcohort_gradient_richardson_depth) >(xl["cohort_gradient_richardson_depth"]);
   ret.cohort_gradient_richardson_depth = Rcpp::as<size_t >(xl["cohort_gradient_richardson_depth"]);
+  // ret.cohort_gradient_neighbour_gap = Rcpp::as<decltype(retcohort_gradient_neighbour_gap) >(xl["cohort_gradient_neighbour_gap"]);
+  ret.cohort_gradient_neighbour_gap = Rcpp::as<double >(xl["cohort_gradient_neighbour_gap"]);
+  // ret.cohort_integration_cubic = Rcpp::as<decltype(retcohort_integration_cubic) >(xl["cohort_integration_cubic"]);
+  ret.cohort_integration_cubic = Rcpp::as<bool >(xl["cohort_integration_cubic"]);
   // ret.environment_light_tol = Rcpp::as<decltype(retenvironment_light_tol) >(xl["environment_light_tol"]);
   ret.environment_light_tol = Rcpp::as<double >(xl["environment_light_tol"]);
   // ret.environment_light_nbase = Rcpp::as<decltype(retenvironment_light_nbase) >(xl["environment_light_nbase"]);
@@ -302,6 +333,12 @@ template <> inline plant::Control as(SEXP x) {
   ret.environment_light_max_depth = Rcpp::as<size_t >(xl["environment_light_max_depth"]);
   // ret.environment_light_rescale_usually = Rcpp::as<decltype(retenvironment_light_rescale_usually) >(xl["environment_light_rescale_usually"]);
   ret.environment_light_rescale_usually = Rcpp::as<bool >(xl["environment_light_rescale_usually"]);
+  // ret.environment_light_reuse_tol = Rcpp::as<decltype(retenvironment_light_reuse_tol) >(xl["environment_light_reuse_tol"]);
+  ret.environment_light_reuse_tol = Rcpp::as<double >(xl["environment_light_reuse_tol"]);
+  // ret.environment_light_monotone = Rcpp::as<decltype(retenvironment_light_monotone) >(xl["environment_light_monotone"]);
+  ret.environment_light_monotone = Rcpp::as<bool >(xl["environment_light_monotone"]);
+  // ret.environment_light_leaf_area = Rcpp::as<decltype(retenvironment_light_leaf_area) >(xl["environment_light_leaf_area"]);
+  ret.environment_light_leaf_area = Rcpp::as<bool >(xl["environment_light_leaf_area"]);
   // ret.ode_step_size_initial = Rcpp::as<decltype(retode_step_size_initial) >(xl["ode_step_size_initial"]);
   ret.ode_step_size_initial = Rcpp::as<double >(xl["ode_step_size_initial"]);
   // ret.ode_step_size_min = Rcpp::as<decltype(retode_step_size_min) >(xl["ode_step_size_min"]);
@@ -316,6 +353,10 @@ template <> inline plant::Control as(SEXP x) {
   ret.ode_a_y = Rcpp::as<double >(xl["ode_a_y"]);
   // ret.ode_a_dydt = Rcpp::as<decltype(retode_a_dydt) >(xl["ode_a_dydt"]);
   ret.ode_a_dydt = Rcpp::as<double >(xl["ode_a_dydt"]);
+  // ret.ode_step_size_pi = Rcpp::as<decltype(retode_step_size_pi) >(xl["ode_step_size_pi"]);
+  ret.ode_step_size_pi = Rcpp::as<bool >(xl["ode_step_size_pi"]);
+  // ret.ode_step_size_estimate = Rcpp::as<decltype(retode_step_size_estimate) >(xl["ode_step_size_estimate"]);
+  ret.ode_step_size_estimate = Rcpp::as<bool >(xl["ode_step_size_estimate"]);
   // ret.schedule_nsteps = Rcpp::as<decltype(retschedule_nsteps) >(xl["schedule_nsteps"]);
   ret.schedule_nsteps = Rcpp::as<size_t >(xl["schedule_nsteps"]);
   // ret.schedule_eps = Rcpp::as<decltype(retschedule_eps) >(xl["schedule_eps"]);
@@ -324,6 +365,14 @@ template <> inline plant::Control as(SEXP x) {
   ret.schedule_verbose = Rcpp::as<bool >(xl["schedule_verbose"]);
   // ret.schedule_patch_survival = Rcpp::as<decltype(retschedule_patch_survival) >(xl["schedule_patch_survival"]);
   ret.schedule_patch_survival = Rcpp::as<double >(xl["schedule_patch_survival"]);
+  // ret.schedule_richardson = Rcpp::as<decltype(retschedule_richardson) >(xl["schedule_richardson"]);
+  ret.schedule_richardson = Rcpp::as<bool >(xl["schedule_richardson"]);
+  // ret.schedule_end_tol = Rcpp::as<decltype(retschedule_end_tol) >(xl["schedule_end_tol"]);
+  ret.schedule_end_tol = Rcpp::as<double >(xl["schedule_end_tol"]);
+  // ret.schedule_end_declines = Rcpp::as<decltype(retschedule_end_declines) >(xl["schedule_end_declines"]);
+  ret.schedule_end_declines = Rcpp::as<size_t >(xl["schedule_end_declines"]);
+  // ret.mesh_n_cells = Rcpp::as<decltype(retmesh_n_cells) >(xl["mesh_n_cells"]);
+  ret.mesh_n_cells = Rcpp::as<size_t >(xl["mesh_n_cells"]);
   // ret.equilibrium_nsteps = Rcpp::as<decltype(retequilibrium_nsteps) >(xl["equilibrium_nsteps"]);
   ret.equilibrium_nsteps = Rcpp::as<size_t >(xl["equilibrium_nsteps"]);
   // ret.equilibrium_eps = Rcpp::as<decltype(retequilibrium_eps) >(xl["equilibrium_eps"]);
@@ -353,6 +402,8 @@ template <> inline SEXP wrap(const plant::ode::OdeControl& x) {
   ret["step_size_min"] = Rcpp::wrap(x.step_size_min);
   ret["step_size_max"] = Rcpp::wrap(x.step_size_max);
   ret["step_size_initial"] = Rcpp::wrap(x.step_size_initial);
+  ret["step_size_pi"] = Rcpp::wrap(x.step_size_pi);
+  ret["step_size_estimate"] = Rcpp::wrap(x.step_size_estimate);
   ret.attr("class") = "OdeControl";
   return ret;
 }
@@ -379,6 +430,10 @@ template <> inline plant::ode::OdeControl as(SEXP x) {
   ret.step_size_max = Rcpp::as<double >(xl["step_size_max"]);
   // ret.step_size_initial = Rcpp::as<decltype(retstep_size_initial) >(xl["step_size_initial"]);
   ret.step_size_initial = Rcpp::as<double >(xl["step_size_initial"]);
+  // ret.step_size_pi = Rcpp::as<decltype(retstep_size_pi) >(xl["step_size_pi"]);
+  ret.step_size_pi = Rcpp::as<bool >(xl["step_size_pi"]);
+  // ret.step_size_estimate = Rcpp::as<decltype(retstep_size_estimate) >(xl["step_size_estimate"]);
+  ret.step_size_estimate = Rcpp::as<bool >(xl["step_size_estimate"]);
   return ret;
 }
 template <> inline SEXP wrap(const plant::quadrature::QK& x) {
@@ -1066,6 +1121,19 @@ template <> inline SEXP wrap(const plant::StochasticPatchRunner<plant::FF16r_Str
 template <> inline plant::StochasticPatchRunner<plant::FF16r_Strategy> as(SEXP x) {
   return *(plant::RcppR6::RcppR6<plant::StochasticPatchRunner<plant::FF16r_Strategy> >(x));
 }
+template <> inline SEXP wrap(const plant::MeshSCM<plant::FF16_Strategy>& x) {
+  return wrap(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> >(x));
+}
+template <> inline plant::MeshSCM<plant::FF16_Strategy> as(SEXP x) {
+  return *(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> >(x));
+}
+
+template <> inline SEXP wrap(const plant::MeshSCM<plant::FF16r_Strategy>& x) {
+  return wrap(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> >(x));
+}
+template <> inline plant::MeshSCM<plant::FF16r_Strategy> as(SEXP x) {
+  return *(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> >(x));
+}
 }
 
 #endif
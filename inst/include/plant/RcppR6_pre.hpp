@@ -115,6 +115,11 @@ template <> plant::StochasticPatchRunner<plant::FF16_Strategy> as(SEXP);
 
 template <> SEXP wrap(const plant::StochasticPatchRunner<plant::FF16r_Strategy>&);
 template <> plant::StochasticPatchRunner<plant::FF16r_Strategy> as(SEXP);
+template <> SEXP wrap(const plant::MeshSCM<plant::FF16_Strategy>&);
+template <> plant::MeshSCM<plant::FF16_Strategy> as(SEXP);
+
+template <> SEXP wrap(const plant::MeshSCM<plant::FF16r_Strategy>&);
+template <> plant::MeshSCM<plant::FF16r_Strategy> as(SEXP);
 }
 
 #endif
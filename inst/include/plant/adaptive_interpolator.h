@@ -12,7 +12,8 @@ namespace interpolator {
 class AdaptiveInterpolator {
 public:
   AdaptiveInterpolator(double atol_, double rtol_,
-                       size_t nbase_, size_t max_depth_)
+                       size_t nbase_, size_t max_depth_,
+                       bool monotone=false)
   : atol(atol_),
     rtol(rtol_),
     nbase(nbase_),
@@ -20,6 +21,7 @@ public:
     dx(NA_REAL),
     dxmin(NA_REAL),
     interpolator() {
+    interpolator.set_monotone(monotone);
   }
 
   template <typename Function>
@@ -16,8 +16,11 @@ public:
   typedef typename strategy_type::ptr strategy_type_ptr;
   Cohort(strategy_type_ptr s);
 
-  void compute_vars_phys(const Environment& environment);
+  void compute_vars_phys(const Environment& environment,
+                         double tol_scale=1.0, bool gradient=true);
+  void set_growth_rate_gradient(double gradient);
   void compute_initial_conditions(const Environment& environment);
+  void compute_initial_density(const Environment& environment);
 
   // * R interface (testing only, really)
   double r_growth_rate_gradient(const Environment& environment);
@@ -26,9 +29,11 @@ public:
   double area_leaf_above(double z) const;
   double area_leaf() const;
   double fecundity() const {return seeds_survival_weighted;}
+  double fecundity_dt() const {return seeds_survival_weighted_dt;}
 
   // Unfortunate, but need a get_ here because of name shadowing...
   double get_log_density() const {return log_density;}
+  double get_density() const {return density;}
   void set_log_density(double x) {
     log_density = x;
     density = exp(log_density);
@@ -54,6 +59,7 @@ public:
 private:
   // This is the gradient of growth rate with respect to height:
   double growth_rate_gradient(const Environment& environment) const;
+  void set_initial_conditions(const Environment& environment);
 
   double log_density;
   double log_density_dt;
@@ -75,14 +81,19 @@ Cohort<T>::Cohort(strategy_type_ptr s)
 }
 
 template <typename T>
-void Cohort<T>::compute_vars_phys(const Environment& environment) {
-  plant.compute_vars_phys(environment);
+void Cohort<T>::compute_vars_phys(const Environment& environment,
+                                  double tol_scale, bool gradient) {
+  plant.compute_vars_phys(environment, false, tol_scale);
 
   // NOTE: This must be called *after* compute_vars_phys, but given we
   // need mortality_dt() that's always going to be the case.
-  log_density_dt =
-    - growth_rate_gradient(environment)
-    - plant.mortality_dt();
+  //
+  // Species may instead estimate the gradient from the neighbouring
+  // cohorts, in which case it passes it in by set_growth_rate_gradient
+  // once all cohorts have been computed.
+  if (gradient) {
+    set_growth_rate_gradient(growth_rate_gradient(environment));
+  }
 
   // survival_plant: converts from the mean of the poisson process (on
   // [0,Inf)) to a probability (on [0,1]).
@@ -101,6 +112,11 @@ void Cohort<T>::compute_vars_phys(const Environment& environment) {
     survival_patch / pr_patch_survival_at_birth;
 }
 
+template <typename T>
+void Cohort<T>::set_growth_rate_gradient(double gradient) {
+  log_density_dt = - gradient - plant.mortality_dt();
+}
+
 // NOTE: There will be a discussion of why the mortality rate initial
 // condition is -log(germination_probability) in the documentation
 // that Daniel is working out.
@@ -110,7 +126,23 @@ void Cohort<T>::compute_vars_phys(const Environment& environment) {
 template <typename T>
 void Cohort<T>::compute_initial_conditions(const Environment& environment) {
   compute_vars_phys(environment);
+  set_initial_conditions(environment);
+}
 
+// A cheaper version of compute_initial_conditions, used for the
+// boundary cohort within Species.  This computes the initial state
+// (and in particular the density, which is needed for the trapezium
+// tail in Species::area_leaf_above) but does not compute the rates
+// that depend on the growth rate gradient, which are only needed
+// once the cohort is actually introduced.
+template <typename T>
+void Cohort<T>::compute_initial_density(const Environment& environment) {
+  plant.compute_vars_phys(environment);
+  set_initial_conditions(environment);
+}
+
+template <typename T>
+void Cohort<T>::set_initial_conditions(const Environment& environment) {
   pr_patch_survival_at_birth = environment.patch_survival();
   const double pr_germ = plant.germination_probability(environment);
   plant.set_mortality(-log(pr_germ));
@@ -133,9 +165,8 @@ void Cohort<T>::compute_initial_conditions(const Environment& environment) {
 
 template <typename T>
 double Cohort<T>::growth_rate_gradient(const Environment& environment) const {
-  plant_type p = plant;
-  auto fun = [&] (double h) mutable -> double {
-    return growth_rate_given_height(p, h, environment);
+  auto fun = [&] (double h) -> double {
+    return plant.height_dt_given_height(h, environment);
   };
 
   const Control& control = plant.control();
@@ -208,14 +239,6 @@ Cohort<T> make_cohort(typename Cohort<T>::strategy_type s) {
   return Cohort<T>(make_strategy_ptr(s));
 }
 
-template <typename T>
-double growth_rate_given_height(T& plant, double height,
-                                const Environment& environment) {
-  plant.set_height(height);
-  plant.compute_vars_phys(environment, true);
-  return plant.height_dt();
-}
-
 }
 
 #endif
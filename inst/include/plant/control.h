@@ -34,6 +34,9 @@ struct Control {
   double plant_assimilation_tol;
   size_t plant_assimilation_iterations;
   size_t plant_assimilation_rule;
+  size_t plant_assimilation_knots;
+  double plant_assimilation_knots_width;
+  double plant_assimilation_tol_weight_max;
 
   double plant_seed_tol;
   size_t plant_seed_iterations;
@@ -42,11 +45,16 @@ struct Control {
   int    cohort_gradient_direction;
   bool   cohort_gradient_richardson;
   size_t cohort_gradient_richardson_depth;
+  double cohort_gradient_neighbour_gap;
+  bool   cohort_integration_cubic;
 
   double environment_light_tol;
   size_t environment_light_nbase;
   size_t environment_light_max_depth;
   bool   environment_light_rescale_usually;
+  double environment_light_reuse_tol;
+  bool   environment_light_monotone;
+  bool   environment_light_leaf_area;
 
   double ode_step_size_initial;
   double ode_step_size_min;
@@ -55,11 +63,18 @@ struct Control {
   double ode_tol_abs;
   double ode_a_y;
   double ode_a_dydt;
+  bool   ode_step_size_pi;
+  bool   ode_step_size_estimate;
 
   size_t schedule_nsteps;
   double schedule_eps;
   bool   schedule_verbose;
   double schedule_patch_survival;
+  bool   schedule_richardson;
+  double schedule_end_tol;
+  size_t schedule_end_declines;
+
+  size_t mesh_n_cells;
 
   size_t equilibrium_nsteps;
   double equilibrium_eps;
@@ -82,7 +97,9 @@ inline ode::OdeControl make_ode_control(const Control& control) {
                          control.ode_a_dydt,
                          control.ode_step_size_min,
                          control.ode_step_size_max,
-                         control.ode_step_size_initial);
+                         control.ode_step_size_initial,
+                         control.ode_step_size_pi,
+                         control.ode_step_size_estimate);
 }
 
 }
@@ -7,6 +7,7 @@
 #include <plant/interpolator.h>
 #include <plant/adaptive_interpolator.h>
 #include <plant/util.h>
+#include <utility>
 
 namespace plant {
 
@@ -16,10 +17,29 @@ public:
               std::vector<double> seed_rain_,
               Control control);
   double canopy_openness(double height) const;
+  double canopy_openness_profile(double y) const;
   template <typename Function>
   void compute_light_environment(Function f_canopy_openness, double height_max);
   template <typename Function>
   void rescale_light_environment(Function f_canopy_openness, double height_max);
+  template <typename Function>
+  bool reuse_light_environment(Function f_canopy_openness, double height_max,
+                               double tol);
+  void set_fixed_canopy_openness(double canopy_openness);
+
+  // Canopy openness at each point of the light environment's
+  // quadrature rule (see Interpolator::compute_quadrature).
+  const std::vector<double>& canopy_openness_quadrature() const;
+  // Sums over the quadrature rule that are the same for every plant
+  // of a strategy (see FF16_Strategy::assimilation_knots).  These are
+  // computed by 'f' the first time they are needed for a rule and
+  // 'key' (the strategy parameters they depend on), and are dropped
+  // along with the rule.
+  typedef std::vector<std::vector<double> > quadrature_sums;
+  template <typename Function>
+  const quadrature_sums&
+  light_environment_quadrature_sums(const std::vector<double>& key,
+                                    Function f) const;
   double patch_survival() const;
   double patch_survival_conditional(double time_at_birth) const;
   void clear();
@@ -31,22 +51,66 @@ public:
 
   // * R interface
   void r_set_seed_rain_index(util::index x);
+  SEXP r_light_environment_openness() const;
 
   double time;
   Disturbance disturbance_regime;
+  // Canopy openness over height.  If the control option
+  // environment_light_leaf_area is set, the Patch passes k_I times the
+  // leaf area index above each height to compute_light_environment
+  // and friends instead of openness, and this holds that extinction
+  // profile; canopy_openness_profile converts values of either to
+  // openness.
   interpolator::Interpolator light_environment;
 
 private:
+  void set_light_environment(const interpolator::Interpolator& profile);
+  void compute_light_environment_quadrature();
   std::vector<double> seed_rain;
   size_t seed_rain_index;
   interpolator::AdaptiveInterpolator light_environment_generator;
+  // Last fully computed profile, that reuse_light_environment
+  // corrects from.
+  interpolator::Interpolator light_environment_reference;
+  bool light_environment_leaf_area;
+  size_t light_environment_quadrature;
+  double light_environment_quadrature_width;
+  std::vector<double> light_environment_quadrature_openness;
+  mutable std::vector<std::pair<std::vector<double>, quadrature_sums> >
+  light_environment_quadrature_cache;
+  // Openness above the light environment; everywhere if it is empty.
+  double canopy_openness_above;
 };
 
+// Canopy openness, given a value of the light environment profile.
+inline double Environment::canopy_openness_profile(double y) const {
+  return light_environment_leaf_area ? exp(-y) : y;
+}
+
+inline const std::vector<double>&
+Environment::canopy_openness_quadrature() const {
+  return light_environment_quadrature_openness;
+}
+
+template <typename Function>
+const Environment::quadrature_sums&
+Environment::light_environment_quadrature_sums(const std::vector<double>& key,
+                                               Function f) const {
+  for (const auto& el : light_environment_quadrature_cache) {
+    if (el.first == key) {
+      return el.second;
+    }
+  }
+  light_environment_quadrature_cache.push_back(std::make_pair(key, f()));
+  return light_environment_quadrature_cache.back().second;
+}
+
 template <typename Function>
 void Environment::compute_light_environment(Function f_canopy_openness,
                                             double height_max) {
-  light_environment =
+  light_environment_reference =
     light_environment_generator.construct(f_canopy_openness, 0, height_max);
+  set_light_environment(light_environment_reference);
 }
 
 template <typename Function>
@@ -59,11 +123,80 @@ void Environment::rescale_light_environment(Function f_canopy_openness,
   util::rescale(h.begin(), h.end(), min, height_max_old, min, height_max);
   h.back() = height_max; // Avoid round-off error.
 
-  light_environment.clear();
+  light_environment_reference.clear();
   for (auto hi : h) {
-    light_environment.add_point(hi, f_canopy_openness(hi));
+    light_environment_reference.add_point(hi, f_canopy_openness(hi));
   }
-  light_environment.initialise();
+  light_environment_reference.initialise();
+  set_light_environment(light_environment_reference);
+}
+
+// Try to avoid recomputing the light environment when the canopy has
+// changed very little since it was last computed.  Canopy openness
+// is exp(-k L(z)) where L(z) is the leaf area above z; if the canopy
+// keeps its shape while its height and total leaf area change, then
+//
+//   L_new(z) = L_old(z H_old / H_new) L_new(0) / L_old(0)
+//
+// and so the old profile, stretched in height and raised to the
+// power log(openness_new(0)) / log(openness_old(0)), gives the new
+// one.  This correction needs one evaluation of 'f_canopy_openness'
+// and is checked with three more, at a quarter, half and three
+// quarters of the canopy height.  If the relative change in height or
+// the error at any of these points exceeds 'tol' this returns false
+// and the light environment is left alone, so that the caller can
+// recompute it.
+//
+// Because the reference profile is only replaced when the light
+// environment is recomputed, the light environment (and so the ODE
+// rates) at a given state depends on the states visited before it.
+// In particular, when the adaptive ODE solver rejects a step and
+// retries it with a smaller one, the retry may see a slightly
+// different right hand side (within 'tol') than the first attempt
+// did, so the usual error control holds only up to 'tol'.
+template <typename Function>
+bool Environment::reuse_light_environment(Function f_canopy_openness,
+                                          double height_max,
+                                          double tol) {
+  const size_t n = light_environment_reference.size();
+  if (n == 0) {
+    return false;
+  }
+  const double height_max_old = light_environment_reference.max();
+  if (std::abs(height_max - height_max_old) > tol * height_max_old) {
+    return false;
+  }
+  // When interpolating leaf area the profile scales linearly rather
+  // than by a power.
+  const double y_0_old = light_environment_reference.eval(0.0),
+    y_0_new = f_canopy_openness(0.0);
+  if (light_environment_leaf_area ? !(y_0_old > 0.0) : !(y_0_old < 1.0)) {
+    return false;
+  }
+  const double p = light_environment_leaf_area ? y_0_new / y_0_old :
+    log(y_0_new) / log(y_0_old),
+    scal = height_max / height_max_old;
+
+  const std::vector<double>
+    x = light_environment_reference.get_x(),
+    y = light_environment_reference.get_y();
+  interpolator::Interpolator corrected = light_environment_reference;
+  corrected.clear();
+  for (size_t i = 0; i < n; ++i) {
+    const double xi = i + 1 == n ? height_max : x[i] * scal;
+    corrected.add_point(xi, light_environment_leaf_area ? y[i] * p : pow(y[i], p));
+  }
+  corrected.initialise();
+
+  for (size_t i = 1; i < 4; ++i) {
+    const double z = i * height_max / 4;
+    if (std::abs(corrected.eval(z) - f_canopy_openness(z)) > tol) {
+      return false;
+    }
+  }
+
+  set_light_environment(corrected);
+  return true;
 }
 
 inline interpolator::AdaptiveInterpolator
@@ -72,7 +205,8 @@ make_interpolator(const Control& control) {
   return AdaptiveInterpolator(control.environment_light_tol,
                               control.environment_light_tol,
                               control.environment_light_nbase,
-                              control.environment_light_max_depth);
+                              control.environment_light_max_depth,
+                              control.environment_light_monotone);
 }
 
 template <typename T>
@@ -0,0 +1,32 @@
+// -*-c++-*-
+#ifndef PLANT_PLANT_FF16_HYPERPAR_H_
+#define PLANT_PLANT_FF16_HYPERPAR_H_
+
+#include <vector>
+
+namespace plant {
+namespace hyperpar {
+
+// Solar model, as used in the FF16 hyperparameterisation.  Solar
+// angle (radians) between the horizon and the sun, for a given
+// latitude (degrees) and time (decimal days since the start of the
+// year), and the incoming PAR [mol / m2 / d] on a surface normal to
+// the sun at that angle.
+double solar_angle(double decimal_day_time, double latitude);
+double PAR_given_solar_angle(double solar_angle);
+
+// Approximate annual assimilation [mol CO2 / m2 / yr] of a leaf with
+// photosynthetic capacity 'A_max' (other arguments as in
+// make_FF16_hyperpar), as a function of canopy openness, fitted to a
+// saturating curve p1 * E / (p2 + E).  Returns {p1, p2}.  Results are
+// cached, as the integration over the year is the expensive part of
+// the hyperparameterisation and is usually repeated for the same few
+// values of narea.
+std::vector<double> FF16_assimilation_fit(double A_max, double theta,
+                                          double QY, double k_I,
+                                          double latitude);
+
+}
+}
+
+#endif
@@ -53,12 +53,13 @@ public:
                            double mass_sapwood, double mass_root) const;
 
   void scm_vars(const Environment& environment, bool reuse_intervals,
-                Plant_internals& vars);
+                Plant_internals& vars, double tol_scale=1.0);
 
   // * Mass production
   // [eqn 12] Gross annual CO2 assimilation
   double assimilation(const Environment& environment, double height,
-                      double area_leaf, bool reuse_intervals);
+                      double area_leaf, bool reuse_intervals,
+                      double tol_scale=1.0);
   // Used internally, corresponding to the inner term in [eqn 12]
   double compute_assimilation_x(double x, double height,
                                 const Environment& environment) const;
@@ -66,6 +67,9 @@ public:
                                 const Environment& environment) const;
   double compute_assimilation_p(double p, double height,
                                 const Environment& environment) const;
+  // Integral in [eqn 12] split at the light environment knots
+  double assimilation_knots(const Environment& environment,
+                            double height) const;
   // [Appendix S6] Per-leaf photosynthetic rate.
   double assimilation_leaf(double x) const;
 
@@ -93,7 +97,8 @@ public:
                                   double turnover) const;
   double net_mass_production_dt(const Environment& environment,
                                 double height, double area_leaf_,
-                                bool reuse_intervals=false);
+                                bool reuse_intervals=false,
+                                double tol_scale=1.0);
 
   // [eqn 16] Fraction of whole plan growth that is leaf
   double fraction_allocation_reproduction(double height) const;
@@ -158,6 +163,8 @@ public:
   double Q(double z, double height) const;
   // [      ] Inverse of Q: height above which fraction 'x' of leaf found
   double Qp(double x, double height) const;
+  // x^eta, used by q and Q
+  double pow_eta(double x) const;
 
   // The aim is to find a plant height that gives the correct seed mass.
   double height_seed(void) const;
@@ -173,11 +180,21 @@ public:
   // Previously there was an "integrator" here.  I'm going to stick
   // that into Control or Environment instead.
 
+  // When integrating assimilation with a fixed (non-adaptive) rule,
+  // the integration points, as a fraction of plant height, are the
+  // same for every plant.  So the fractions and weights (which
+  // include q(z, height) when integrating over height) are computed
+  // once in prepare_strategy.
+  std::vector<double> assimilation_fraction;
+  std::vector<double> assimilation_weight;
+
   // * Core traits
   double lma, rho, hmat, omega;
   // * Individual allometry
   // Canopy shape parameters
   double eta, eta_c;
+  // eta, if it is a small integer (zero otherwise)
+  size_t eta_int;
   // Sapwood area per leaf area
   double theta;
   // Empirical constants for scaling relationships
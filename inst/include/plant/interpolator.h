@@ -11,6 +11,8 @@ namespace interpolator {
 
 class Interpolator {
 public:
+  Interpolator() : active(false), monotone(false), quad_n(0),
+                   quad_width(0) {}
   void init(const std::vector<double>& x_,
             const std::vector<double>& y_);
   void initialise();
@@ -27,15 +29,47 @@ public:
   std::vector<double> get_x() const;
   std::vector<double> get_y() const;
 
+  // Use monotone (PCHIP) rather than natural cubic spline
+  // interpolation; takes effect on the next initialise().
+  void set_monotone(bool x);
+  bool is_monotone() const;
+
+  // Composite Gauss-Legendre rule, with the interpolated function at
+  // each point, for integrating functions of the interpolated
+  // function (whose higher derivatives jump at the knots).  Each
+  // interval between knots is split into equal panels no wider than
+  // 'width' times its upper end, with an 'n' point rule on each
+  // panel; quadrature_index() gives the index of the first point
+  // above each knot, and quadrature_rule_x() and quadrature_rule_w()
+  // the 'n' point rule on [-1, 1].  This is discarded whenever the
+  // interpolator changes; quadrature_points() is zero if there is no
+  // rule.
+  void compute_quadrature(size_t n, double width);
+  size_t quadrature_points() const;
+  double quadrature_width() const;
+  const std::vector<double>& quadrature_knots() const;
+  const std::vector<double>& quadrature_rule_x() const;
+  const std::vector<double>& quadrature_rule_w() const;
+  const std::vector<size_t>& quadrature_index() const;
+  const std::vector<double>& quadrature_x() const;
+  const std::vector<double>& quadrature_w() const;
+  const std::vector<double>& quadrature_y() const;
+
   // * R interface
   SEXP r_get_xy() const;
   std::vector<double> r_eval(std::vector<double> u) const;
 
 private:
   void check_active() const;
+  void clear_quadrature();
   std::vector<double> x, y;
   tk::spline tk_spline;
   bool active;
+  bool monotone;
+  std::vector<double> quad_x, quad_w, quad_y, quad_gx, quad_gw;
+  std::vector<size_t> quad_index;
+  size_t quad_n;
+  double quad_width;
 };
 
 }
@@ -0,0 +1,187 @@
+// -*-c++-*-
+#ifndef PLANT_PLANT_MESH_PATCH_H_
+#define PLANT_PLANT_MESH_PATCH_H_
+
+#include <plant/parameters.h>
+#include <plant/mesh_species.h>
+#include <plant/ode_interface.h>
+
+namespace plant {
+
+// The patch for the mesh model (see MeshSpecies).  This has the
+// same light environment as Patch, but plants enter continuously
+// through the bottom of the mesh rather than being introduced as
+// cohorts, so there is no schedule to follow.
+template <typename T>
+class MeshPatch {
+public:
+  typedef T              strategy_type;
+  typedef Plant<T>       plant_type;
+  typedef MeshSpecies<T> species_type;
+  typedef Parameters<T>  parameters_type;
+
+  MeshPatch(parameters_type p);
+
+  void reset();
+  size_t size() const {return species.size();}
+  double time() const {return environment.time;}
+
+  double height_max() const;
+
+  // [eqn 11] Canopy openness at `height`
+  double area_leaf_above(double height) const;
+  double canopy_openness(double height) const;
+
+  const species_type& at(size_t species_index) const {
+    return species[species_index];
+  }
+  const Disturbance& disturbance_regime() const {
+    return environment.disturbance_regime;
+  }
+
+  // * ODE interface
+  size_t ode_size() const;
+  double ode_time() const;
+  ode::const_iterator set_ode_state(ode::const_iterator it, double time);
+  ode::iterator       ode_state(ode::iterator it) const;
+  ode::iterator       ode_rates(ode::iterator it) const;
+
+  // * R interface
+  parameters_type r_parameters() const {return parameters;}
+  Environment r_environment() const {return environment;}
+
+private:
+  double canopy_extinction(double height) const;
+  double light_environment_target(double height) const;
+  void compute_light_environment();
+  void rescale_light_environment();
+  void compute_vars_phys();
+
+  parameters_type parameters;
+  std::vector<bool> is_resident;
+  Environment environment;
+  std::vector<species_type> species;
+};
+
+template <typename T>
+MeshPatch<T>::MeshPatch(parameters_type p)
+  : parameters(p),
+    is_resident(p.is_resident),
+    environment(make_environment(parameters)) {
+  parameters.validate();
+  for (auto s : parameters.strategies) {
+    species.push_back(species_type(s, parameters.control.mesh_n_cells));
+  }
+  reset();
+}
+
+template <typename T>
+void MeshPatch<T>::reset() {
+  for (auto& s : species) {
+    s.clear();
+  }
+  environment.clear();
+  compute_light_environment();
+  compute_vars_phys();
+}
+
+template <typename T>
+double MeshPatch<T>::height_max() const {
+  double ret = 0.0;
+  for (size_t i = 0; i < species.size(); ++i) {
+    if (is_resident[i]) {
+      ret = std::max(ret, species[i].height_max());
+    }
+  }
+  return ret;
+}
+
+template <typename T>
+double MeshPatch<T>::area_leaf_above(double height) const {
+  double tot = 0.0;
+  for (size_t i = 0; i < species.size(); ++i) {
+    if (is_resident[i]) {
+      tot += species[i].area_leaf_above(height);
+    }
+  }
+  return tot;
+}
+
+template <typename T>
+double MeshPatch<T>::canopy_openness(double height) const {
+  return exp(-canopy_extinction(height));
+}
+
+template <typename T>
+double MeshPatch<T>::canopy_extinction(double height) const {
+  return parameters.k_I * area_leaf_above(height) / parameters.patch_area;
+}
+
+template <typename T>
+double MeshPatch<T>::light_environment_target(double height) const {
+  return parameters.control.environment_light_leaf_area ?
+    canopy_extinction(height) : canopy_openness(height);
+}
+
+template <typename T>
+void MeshPatch<T>::compute_light_environment() {
+  if (parameters.n_residents() > 0) {
+    auto f = [&] (double x) -> double {return light_environment_target(x);};
+    environment.compute_light_environment(f, height_max());
+  }
+}
+
+template <typename T>
+void MeshPatch<T>::rescale_light_environment() {
+  if (parameters.n_residents() > 0) {
+    auto f = [&] (double x) -> double {return light_environment_target(x);};
+    environment.rescale_light_environment(f, height_max());
+  }
+}
+
+template <typename T>
+void MeshPatch<T>::compute_vars_phys() {
+  for (size_t i = 0; i < size(); ++i) {
+    environment.set_seed_rain_index(i);
+    species[i].compute_vars_phys(environment);
+  }
+}
+
+// ODE interface
+template <typename T>
+size_t MeshPatch<T>::ode_size() const {
+  return ode::ode_size(species.begin(), species.end());
+}
+
+template <typename T>
+double MeshPatch<T>::ode_time() const {
+  return time();
+}
+
+template <typename T>
+ode::const_iterator MeshPatch<T>::set_ode_state(ode::const_iterator it,
+                                                double time) {
+  it = ode::set_ode_state(species.begin(), species.end(), it);
+  environment.time = time;
+  if (parameters.control.environment_light_rescale_usually) {
+    rescale_light_environment();
+  } else {
+    compute_light_environment();
+  }
+  compute_vars_phys();
+  return it;
+}
+
+template <typename T>
+ode::iterator MeshPatch<T>::ode_state(ode::iterator it) const {
+  return ode::ode_state(species.begin(), species.end(), it);
+}
+
+template <typename T>
+ode::iterator MeshPatch<T>::ode_rates(ode::iterator it) const {
+  return ode::ode_rates(species.begin(), species.end(), it);
+}
+
+}
+
+#endif
@@ -0,0 +1,125 @@
+// -*-c++-*-
+#ifndef PLANT_PLANT_MESH_SCM_H_
+#define PLANT_PLANT_MESH_SCM_H_
+
+#include <plant/mesh_patch.h>
+#include <plant/ode_solver.h>
+#include <plant/scm_utils.h>
+
+namespace plant {
+
+// Runs the mesh model (see MeshSpecies) to the end of the cohort
+// schedule (Parameters::cohort_schedule_max_time; the introduction
+// times themselves are not used), giving seed rains comparable with
+// those of the SCM.  The number of variables is set by
+// Control::mesh_n_cells, so memory and the cost of each step are
+// bounded whatever the length of the run, and no schedule needs
+// building; the price is the numerical diffusion of the mesh, which
+// converges at roughly first order in the number of cells (see
+// MeshSpecies for where its second order reconstruction falls short).
+template <typename T>
+class MeshSCM {
+public:
+  typedef T             strategy_type;
+  typedef MeshPatch<T>  patch_type;
+  typedef Parameters<T> parameters_type;
+
+  MeshSCM(parameters_type p);
+
+  void run();
+  void advance(double time);
+
+  double time() const {return patch.time();}
+  void reset();
+  bool complete() const;
+
+  // * Output total seed rain calculation (not per capita)
+  double seed_rain(size_t species_index) const;
+  std::vector<double> seed_rains() const;
+
+  // * R interface
+  parameters_type r_parameters() const {return parameters;}
+  std::vector<double> r_ode_times() const {return solver.get_times();}
+  std::vector<std::vector<double> > r_heights() const;
+  std::vector<std::vector<double> > r_densities() const;
+
+private:
+  parameters_type parameters;
+  patch_type patch;
+  ode::Solver<patch_type> solver;
+};
+
+template <typename T>
+MeshSCM<T>::MeshSCM(parameters_type p)
+  : parameters(p),
+    patch(parameters),
+    solver(patch, make_ode_control(p.control)) {
+  parameters.validate();
+  if (!util::identical(parameters.patch_area, 1.0)) {
+    util::stop("Patch area must be exactly 1 for the MeshSCM");
+  }
+}
+
+template <typename T>
+void MeshSCM<T>::run() {
+  reset();
+  advance(parameters.cohort_schedule_max_time);
+}
+
+// Advance to 'time', or the end of the run if that is sooner.
+template <typename T>
+void MeshSCM<T>::advance(double time_) {
+  const double time_max = parameters.cohort_schedule_max_time;
+  if (time_ < time()) {
+    util::stop("Can't advance to a time before the current time");
+  }
+  solver.advance(patch, std::min(time_, time_max));
+}
+
+template <typename T>
+void MeshSCM<T>::reset() {
+  patch.reset();
+  solver.reset(patch);
+}
+
+template <typename T>
+bool MeshSCM<T>::complete() const {
+  return time() >= parameters.cohort_schedule_max_time;
+}
+
+template <typename T>
+double MeshSCM<T>::seed_rain(size_t species_index) const {
+  return parameters.strategies[species_index].S_D *
+    patch.at(species_index).seeds();
+}
+
+template <typename T>
+std::vector<double> MeshSCM<T>::seed_rains() const {
+  std::vector<double> ret;
+  for (size_t i = 0; i < patch.size(); ++i) {
+    ret.push_back(seed_rain(i));
+  }
+  return ret;
+}
+
+template <typename T>
+std::vector<std::vector<double> > MeshSCM<T>::r_heights() const {
+  std::vector<std::vector<double> > ret;
+  for (size_t i = 0; i < patch.size(); ++i) {
+    ret.push_back(patch.at(i).r_heights());
+  }
+  return ret;
+}
+
+template <typename T>
+std::vector<std::vector<double> > MeshSCM<T>::r_densities() const {
+  std::vector<std::vector<double> > ret;
+  for (size_t i = 0; i < patch.size(); ++i) {
+    ret.push_back(patch.at(i).r_densities());
+  }
+  return ret;
+}
+
+}
+
+#endif
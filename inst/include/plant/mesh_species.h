@@ -0,0 +1,261 @@
+// -*-c++-*-
+#ifndef PLANT_PLANT_MESH_SPECIES_H_
+#define PLANT_PLANT_MESH_SPECIES_H_
+
+#include <vector>
+#include <plant/util.h>
+#include <plant/environment.h>
+#include <plant/ode_interface.h>
+#include <plant/plant.h>
+
+namespace plant {
+
+// An alternative to Species for a mesh ("Eulerian") approximation of
+// the size-structured model.  Rather than following cohorts along
+// characteristics, the height distribution is divided into a fixed
+// number of cells (Control::mesh_n_cells), and the number of plants
+// in each cell (per unit area) is stepped through time.  With n the
+// density of plants per unit height, g the height growth rate and d
+// the mortality rate,
+//
+//   dn/dt + d(g n)/dh = -d n
+//
+// with an influx of g n = seed rain * germination probability at the
+// seedling height h0.
+//
+// The tallest plants are those that arrived first, so the
+// distribution ends abruptly at the height H(t) of a plant that
+// arrived at time zero.  A fixed mesh would smear that front out
+// (which, as those plants dominate both the canopy and seed output,
+// gives poor seed rains even with hundreds of cells), so instead the
+// mesh stretches to follow it: H is an ODE variable with dH/dt =
+// g(H), and the cells are spaced evenly in log(h) between h0 and H.
+// The flux through each (moving) cell edge is the density there
+// times the growth rate relative to the edge, upwinded with a
+// slope-limited (monotonised central) linear reconstruction of the
+// density, so plants are conserved apart from mortality and
+// densities stay positive.  The top edge moves with the plants, so
+// nothing crosses it.  The reconstruction is second order where the
+// density is smooth, but drops to first order at its extrema (where
+// the slope is limited to zero) and in the end cells, next to the
+// seedling boundary and the front, so overall the mesh converges at
+// roughly first order in the number of cells.
+//
+// Each cell is represented by a plant at its midpoint, which gives
+// the growth, mortality and fecundity rates of the cell and its
+// contribution to the leaf area above each height.  No growth rate
+// gradient is needed, and the number of variables is fixed whatever
+// the length of the run.
+//
+// The final ODE variable is the seed output of the species, weighted
+// by the patch age density, so that this is the seed rain (before
+// dispersal) at the end of the run.
+template <typename T>
+class MeshSpecies {
+public:
+  typedef T        strategy_type;
+  typedef Plant<T> plant_type;
+  typedef typename strategy_type::ptr strategy_type_ptr;
+  MeshSpecies(strategy_type s, size_t n_cells);
+
+  size_t size() const {return plants.size();}
+  void clear();
+
+  double height_max() const {return front.height();}
+  double area_leaf_above(double height) const;
+  void compute_vars_phys(const Environment& environment);
+  double seeds() const {return seeds_survival_weighted;}
+
+  // * ODE interface
+  size_t ode_size() const {return size() + 2;}
+  ode::const_iterator set_ode_state(ode::const_iterator it);
+  ode::iterator       ode_state(ode::iterator it) const;
+  ode::iterator       ode_rates(ode::iterator it) const;
+
+  // * R interface
+  std::vector<double> r_edges() const {return edges;}
+  std::vector<double> r_heights() const;
+  std::vector<double> r_densities() const;
+
+private:
+  void set_height_max(double height);
+  double density_slope(size_t i) const;
+
+  strategy_type_ptr strategy;
+  plant_type seed;
+  plant_type front;
+  std::vector<double> edges;
+  std::vector<plant_type> plants;
+  std::vector<double> number;
+  std::vector<double> number_dt;
+  double seeds_survival_weighted;
+  double seeds_survival_weighted_dt;
+};
+
+template <typename T>
+MeshSpecies<T>::MeshSpecies(strategy_type s, size_t n_cells)
+  : strategy(make_strategy_ptr(s)),
+    seed(strategy),
+    front(strategy),
+    edges(n_cells + 1),
+    plants(n_cells, plant_type(strategy)) {
+  if (n_cells < 2) {
+    util::stop("Need at least two cells in the mesh");
+  }
+  clear();
+}
+
+// The mesh cannot start with zero width, so the front starts just
+// above the seedling height; the error from this is far smaller than
+// that of the mesh itself.
+template <typename T>
+void MeshSpecies<T>::clear() {
+  number.assign(size(), 0.0);
+  number_dt.assign(size(), 0.0);
+  seeds_survival_weighted = 0.0;
+  seeds_survival_weighted_dt = 0.0;
+  set_height_max(seed.height() * (1 + 1e-3));
+}
+
+template <typename T>
+void MeshSpecies<T>::set_height_max(double height) {
+  const size_t n = size();
+  const double height_0 = seed.height();
+  const double r = log(height / height_0);
+  front.set_height(height);
+  for (size_t i = 0; i <= n; ++i) {
+    edges[i] = i == n ? height : height_0 * exp(r * i / n);
+  }
+  for (size_t i = 0; i < n; ++i) {
+    plants[i].set_height((edges[i] + edges[i + 1]) / 2);
+  }
+}
+
+template <typename T>
+double MeshSpecies<T>::area_leaf_above(double height) const {
+  double tot = 0.0;
+  for (size_t i = size(); i > 0; --i) {
+    const plant_type& p = plants[i - 1];
+    if (p.height() <= height) {
+      break;
+    }
+    if (number[i - 1] > 0) {
+      tot += number[i - 1] * p.area_leaf_above(height);
+    }
+  }
+  return tot;
+}
+
+template <typename T>
+void MeshSpecies<T>::compute_vars_phys(const Environment& environment) {
+  const size_t n = size();
+  double fecundity_dt = 0.0;
+  for (size_t i = 0; i < n; ++i) {
+    plant_type& p = plants[i];
+    p.compute_vars_phys(environment);
+    fecundity_dt += p.fecundity_dt() * std::max(number[i], 0.0);
+  }
+  front.compute_vars_phys(environment);
+
+  // Edge k moves at (k / n) e_k dH/dt / H; the flux through it is the
+  // density on the upwind side times the growth rate relative to the
+  // edge (with the growth rate interpolated between the cells).
+  const double height = front.height();
+  const double rate = front.height_dt() / height;
+  double flux_below =
+    environment.seed_rain_dt() * seed.germination_probability(environment);
+  for (size_t i = 0; i < n; ++i) {
+    double flux = 0.0;
+    if (i + 1 < n) {
+      const double e = edges[i + 1];
+      const double w = e * rate * (i + 1) / n;
+      const double v =
+        (plants[i].height_dt() + plants[i + 1].height_dt()) / 2 - w;
+      const size_t j = v > 0 ? i : i + 1;
+      const double density = std::max(number[j], 0.0) /
+        (edges[j + 1] - edges[j]) +
+        density_slope(j) * (e - plants[j].height());
+      flux = v * std::max(density, 0.0);
+    }
+    const double mortality = number[i] > 0 ?
+      plants[i].mortality_dt() * number[i] : 0.0;
+    number_dt[i] = flux_below - flux - mortality;
+    flux_below = flux;
+  }
+
+  seeds_survival_weighted_dt =
+    fecundity_dt * environment.disturbance_regime.density(environment.time);
+}
+
+// Monotonised central slope of the density within cell i (zero in the
+// end cells).
+template <typename T>
+double MeshSpecies<T>::density_slope(size_t i) const {
+  if (i == 0 || i + 1 == size()) {
+    return 0.0;
+  }
+  auto density = [&] (size_t j) -> double {
+    return std::max(number[j], 0.0) / (edges[j + 1] - edges[j]);
+  };
+  const double s_below = (density(i) - density(i - 1)) /
+    (plants[i].height() - plants[i - 1].height());
+  const double s_above = (density(i + 1) - density(i)) /
+    (plants[i + 1].height() - plants[i].height());
+  if (s_below * s_above <= 0) {
+    return 0.0;
+  }
+  const double s_mid = (s_below + s_above) / 2;
+  const double s = std::min(std::min(2 * std::abs(s_below),
+                                     2 * std::abs(s_above)),
+                            std::abs(s_mid));
+  return s_mid > 0 ? s : -s;
+}
+
+template <typename T>
+ode::const_iterator MeshSpecies<T>::set_ode_state(ode::const_iterator it) {
+  for (auto& x : number) {
+    x = *it++;
+  }
+  set_height_max(*it++);
+  seeds_survival_weighted = *it++;
+  return it;
+}
+
+template <typename T>
+ode::iterator MeshSpecies<T>::ode_state(ode::iterator it) const {
+  it = std::copy(number.begin(), number.end(), it);
+  *it++ = front.height();
+  *it++ = seeds_survival_weighted;
+  return it;
+}
+
+template <typename T>
+ode::iterator MeshSpecies<T>::ode_rates(ode::iterator it) const {
+  it = std::copy(number_dt.begin(), number_dt.end(), it);
+  *it++ = front.height_dt();
+  *it++ = seeds_survival_weighted_dt;
+  return it;
+}
+
+template <typename T>
+std::vector<double> MeshSpecies<T>::r_heights() const {
+  std::vector<double> ret;
+  for (const auto& p : plants) {
+    ret.push_back(p.height());
+  }
+  return ret;
+}
+
+// Density per unit height (comparable with Cohort densities).
+template <typename T>
+std::vector<double> MeshSpecies<T>::r_densities() const {
+  std::vector<double> ret;
+  for (size_t i = 0; i < size(); ++i) {
+    ret.push_back(number[i] / (edges[i + 1] - edges[i]));
+  }
+  return ret;
+}
+
+}
+
+#endif
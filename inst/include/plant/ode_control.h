@@ -14,7 +14,8 @@ struct OdeControl {
   OdeControl(double tol_abs_, double tol_rel_,
 	     double a_y_, double a_dydt_,
 	     double step_size_min_, double step_size_max_,
-	     double step_size_initial_);
+	     double step_size_initial_,
+	     bool step_size_pi_, bool step_size_estimate_);
 
   double adjust_step_size(size_t dim, size_t ord, double step_size,
 			  const state_type& y,
@@ -22,10 +23,16 @@ struct OdeControl {
 			  const state_type& yp);
   double errlevel(double y, double dydt, double step_size) const;
   bool step_size_shrank() const;
+  void reset_step_size_history();
 
   double tol_abs, tol_rel, a_y, a_dydt;
   double step_size_min, step_size_max, step_size_initial;
+  // Use a PI controller for the step size (step_size_pi), and estimate
+  // the initial step size from the rates when the system is reset or
+  // resized (step_size_estimate); see Solver::estimate_step_size.
+  bool step_size_pi, step_size_estimate;
   bool last_step_size_shrank;
+  double last_error; // Scaled error of the last accepted step
 };
 
 }
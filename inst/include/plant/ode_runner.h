@@ -24,12 +24,19 @@ public:
   void set_state_from_system() {solver.set_state_from_system(obj);}
   std::vector<double> times() const {return solver.get_times();}
   T object() const {return obj;}
+  // Replace the system, which may have changed size (its time must
+  // match the solver's, as for set_state_from_system).
+  void set_object(T obj_) {
+    obj = obj_;
+    solver.set_state_from_system(obj);
+  }
   void advance(double time) {solver.advance(obj, time);}
   void advance_fixed(std::vector<double> times) {
     solver.advance_fixed(obj, times);
   }
   void step() {solver.step(obj);}
   void step_to(double time) {solver.step_to(obj, time);}
+  void set_time_max(double time) {solver.set_time_max(time);}
 
   T obj;
   Solver<T> solver;
@@ -7,6 +7,8 @@
 #include <plant/ode_step.h>
 #include <plant/util.h>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <vector>
 #include <cstddef>
@@ -38,11 +40,14 @@ private:
   void setup_dydt_in(System& system);
   void save_dydt_out_as_in();
   void set_time(double t);
+  double estimate_step_size(System& system);
 
   OdeControl control;
   Step<System> stepper;
 
   double step_size_last; // Size of last successful step (or suggestion)
+  // Estimate the step size before the next step (see estimate_step_size)
+  bool step_size_estimate_pending;
 
   double time;     // Current time
   double time_max; // Time we will not go past
@@ -69,14 +74,33 @@ Solver<System>::Solver(const System& system, OdeControl control_)
 template <class System>
 void Solver<System>::reset(const System& system) {
   prev_times.clear();
-  step_size_last = control.step_size_initial;
+  control.reset_step_size_history();
+  if (control.step_size_estimate) {
+    step_size_last = control.step_size_max;
+    step_size_estimate_pending = true;
+  } else {
+    step_size_last = control.step_size_initial;
+    step_size_estimate_pending = false;
+  }
   time_max = std::numeric_limits<double>::infinity();
   set_state_from_system(system);
 }
 
+// When the size of the system changes (in the SCM, when a cohort is
+// introduced) the rates of the new variables are often much larger
+// than those of the old ones, and the last step size is far too long;
+// with OdeControl::step_size_estimate a fresh estimate is made before
+// the next step, rather than finding this out through a cascade of
+// rejected steps.
 template <class System>
 void Solver<System>::set_state_from_system(const System& system) {
   set_time(ode::ode_time(system));
+  if (system.ode_size() != y.size()) {
+    control.reset_step_size_history();
+    if (control.step_size_estimate) {
+      step_size_estimate_pending = true;
+    }
+  }
   resize(system.ode_size());
   system.ode_state(y.begin());
   system.ode_rates(dydt_in.begin());
@@ -139,7 +163,6 @@ void Solver<System>::advance_fixed(System& system,
 template <class System>
 void Solver<System>::step(System& system) {
   const double time_orig = time, time_remaining = time_max - time;
-  double step_size = step_size_last;
 
   // Save y in case of failure in a step (recall that stepper.step
   // changes 'y')
@@ -149,6 +172,12 @@ void Solver<System>::step(System& system) {
   // Compute the derivatives at the beginning.
   setup_dydt_in(system);
 
+  if (step_size_estimate_pending && size > 0) {
+    step_size_last = std::min(step_size_last, estimate_step_size(system));
+    step_size_estimate_pending = false;
+  }
+  double step_size = step_size_last;
+
   while (true) {
     // Does this appear to be the last step before reaching `time_max`?
     const bool final_step = step_size > time_remaining;
@@ -248,6 +277,47 @@ void Solver<System>::save_dydt_out_as_in() {
   }
 }
 
+// Starting step size from Hairer, Norsett & Wanner (1993) "Solving
+// Ordinary Differential Equations I", section II.4: a first guess
+// from the sizes of the state and its rates (scaled by the error
+// tolerance), then refined by an explicit Euler step that estimates
+// the second derivative.  This costs one evaluation of the rates, and
+// leaves the system at the trial state; the next step sets it again.
+template <class System>
+double Solver<System>::estimate_step_size(System& system) {
+  const size_t size = y.size();
+  state_type scale(size);
+  double d0 = 0.0, d1 = 0.0;
+  for (size_t i = 0; i < size; ++i) {
+    scale[i] = control.errlevel(y[i], 0.0, 0.0);
+    const double y_i = y[i] / scale[i], dydt_i = dydt_in[i] / scale[i];
+    d0 += y_i * y_i;
+    d1 += dydt_i * dydt_i;
+  }
+  d0 = std::sqrt(d0 / size);
+  d1 = std::sqrt(d1 / size);
+  const double h0 = std::min(d0 < 1e-5 || d1 < 1e-5 ? 1e-6 : 0.01 * d0 / d1,
+                             control.step_size_max);
+
+  state_type y1(size), dydt1(size);
+  for (size_t i = 0; i < size; ++i) {
+    y1[i] = y[i] + h0 * dydt_in[i];
+  }
+  ode::derivs(system, y1, dydt1, time + h0);
+  double d2 = 0.0;
+  for (size_t i = 0; i < size; ++i) {
+    const double ddydt_i = (dydt1[i] - dydt_in[i]) / scale[i];
+    d2 += ddydt_i * ddydt_i;
+  }
+  d2 = std::sqrt(d2 / size) / h0;
+
+  const double d = std::max(d1, d2);
+  const double h1 = d <= 1e-15 ? std::max(1e-6, h0 * 1e-3) :
+    std::pow(0.01 / d, 1.0 / (stepper.order() + 1.0));
+  return util::clamp(std::min(100 * h0, h1),
+                     control.step_size_min, control.step_size_max);
+}
+
 template <typename System>
 void Solver<System>::set_time(double t) {
   const int ulp = 2; // units in the last place (accuracy)
@@ -20,6 +20,7 @@ public:
   Patch(parameters_type p);
 
   void reset();
+  void reserve(size_t species_index, size_t n) {species[species_index].reserve(n);}
   size_t size() const {return species.size();}
   double time() const {return environment.time;}
 
@@ -38,6 +39,11 @@ public:
   const Disturbance& disturbance_regime() const {
     return environment.disturbance_regime;
   }
+  std::vector<double>
+  integrate_internals(size_t species_index,
+                      const std::vector<PlantPlus_internals_member>& members) const {
+    return species[species_index].integrate_internals(members, environment);
+  }
 
   // * ODE interface
   size_t ode_size() const;
@@ -50,7 +56,7 @@ public:
   // Data accessors:
   parameters_type r_parameters() const {return parameters;}
   Environment r_environment() const {return environment;}
-  std::vector<species_type> r_species() const {return species;}
+  std::vector<species_type> r_species() const;
   std::vector<double> r_area_leaf_error(size_t species_index) const;
   void r_set_state(double time,
                    const std::vector<double>& state,
@@ -67,8 +73,11 @@ public:
   void r_compute_vars_phys() {compute_vars_phys();}
 
 private:
+  double canopy_extinction(double height) const;
+  double light_environment_target(double height) const;
   void compute_light_environment();
   void rescale_light_environment();
+  bool reuse_light_environment();
   void compute_vars_phys();
 
   parameters_type parameters;
@@ -123,10 +132,36 @@ double Patch<T>::area_leaf_above(double height) const {
 
 template <typename T>
 double Patch<T>::canopy_openness(double height) const {
+  return exp(-canopy_extinction(height));
+}
+
+template <typename T>
+double Patch<T>::canopy_extinction(double height) const {
   // NOTE: patch_area does not appear in the SCM model formulation;
   // really we should require that it is 1.0, or drop it entirely.
-  return exp(-parameters.k_I * area_leaf_above(height) /
-             parameters.patch_area);
+  return parameters.k_I * area_leaf_above(height) / parameters.patch_area;
+}
+
+// The function that the light environment interpolates: canopy
+// openness, or the (smoother) leaf area above each height.
+template <typename T>
+double Patch<T>::light_environment_target(double height) const {
+  return parameters.control.environment_light_leaf_area ?
+    canopy_extinction(height) : canopy_openness(height);
+}
+
+// The species as seen from R include the rates of their boundary
+// seeds, which are otherwise only computed when a seed is introduced
+// (see Species::add_seed).
+template <typename T>
+std::vector<typename Patch<T>::species_type> Patch<T>::r_species() const {
+  std::vector<species_type> ret = species;
+  Environment env = environment;
+  for (size_t i = 0; i < ret.size(); ++i) {
+    env.set_seed_rain_index(i);
+    ret[i].compute_seed_rates(env);
+  }
+  return ret;
 }
 
 template <typename T>
@@ -138,7 +173,7 @@ std::vector<double> Patch<T>::r_area_leaf_error(size_t species_index) const {
 template <typename T>
 void Patch<T>::compute_light_environment() {
   if (parameters.n_residents() > 0) {
-    auto f = [&] (double x) -> double {return canopy_openness(x);};
+    auto f = [&] (double x) -> double {return light_environment_target(x);};
     environment.compute_light_environment(f, height_max());
   }
 }
@@ -146,11 +181,21 @@ void Patch<T>::compute_light_environment() {
 template <typename T>
 void Patch<T>::rescale_light_environment() {
   if (parameters.n_residents() > 0) {
-    auto f = [&] (double x) -> double {return canopy_openness(x);};
+    auto f = [&] (double x) -> double {return light_environment_target(x);};
     environment.rescale_light_environment(f, height_max());
   }
 }
 
+template <typename T>
+bool Patch<T>::reuse_light_environment() {
+  const double tol = parameters.control.environment_light_reuse_tol;
+  if (tol > 0.0 && parameters.n_residents() > 0) {
+    auto f = [&] (double x) -> double {return light_environment_target(x);};
+    return environment.reuse_light_environment(f, height_max(), tol);
+  }
+  return false;
+}
+
 template <typename T>
 void Patch<T>::compute_vars_phys() {
   for (size_t i = 0; i < size(); ++i) {
@@ -164,7 +209,8 @@ void Patch<T>::compute_vars_phys() {
 // light environment; probably worth just doing a rescale there?
 template <typename T>
 void Patch<T>::add_seed(size_t species_index) {
-  species[species_index].add_seed();
+  environment.set_seed_rain_index(species_index);
+  species[species_index].add_seed(environment);
   if (parameters.is_resident[species_index]) {
     compute_light_environment();
   }
@@ -174,7 +220,8 @@ template <typename T>
 void Patch<T>::add_seeds(const std::vector<size_t>& species_index) {
   bool recompute = false;
   for (size_t i : species_index) {
-    species[i].add_seed();
+    environment.set_seed_rain_index(i);
+    species[i].add_seed(environment);
     recompute = recompute || parameters.is_resident[i];
   }
   if (recompute) {
@@ -233,7 +280,9 @@ ode::const_iterator Patch<T>::set_ode_state(ode::const_iterator it,
                                             double time) {
   it = ode::set_ode_state(species.begin(), species.end(), it);
   environment.time = time;
-  if (parameters.control.environment_light_rescale_usually) {
+  if (reuse_light_environment()) {
+    // Corrected from the last light environment; nothing to do.
+  } else if (parameters.control.environment_light_rescale_usually) {
     rescale_light_environment();
   } else {
     compute_light_environment();
@@ -48,8 +48,21 @@ public:
   }
 
   void compute_vars_phys(const Environment& environment,
-                         bool reuse_intervals=false) {
-    strategy->scm_vars(environment, reuse_intervals, vars);
+                         bool reuse_intervals=false,
+                         double tol_scale=1.0) {
+    strategy->scm_vars(environment, reuse_intervals, vars, tol_scale);
+  }
+  // Height growth rate that this plant would have at height
+  // 'height_', leaving the plant itself untouched.  This is used for
+  // growth rate gradients and avoids copying the whole plant (and
+  // with it the shared strategy pointer) for each evaluation.
+  double height_dt_given_height(double height_,
+                                const Environment& environment) const {
+    internals v = vars;
+    v.height    = height_;
+    v.area_leaf = strategy->area_leaf(height_);
+    strategy->scm_vars(environment, true, v);
+    return v.height_dt;
   }
   double germination_probability(const Environment& environment) {
     return strategy->germination_probability(environment);
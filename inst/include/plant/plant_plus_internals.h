@@ -2,6 +2,9 @@
 #ifndef PLANT_PLANT_PLANT_PLUS_INTERNALS_H_
 #define PLANT_PLANT_PLANT_PLUS_INTERNALS_H_
 
+#include <string>
+#include <vector>
+
 namespace plant {
 
 struct PlantPlus_internals {
@@ -61,6 +64,13 @@ public:
   double ddiameter_stem_darea_stem;
 };
 
+// Allows variables to be selected by name at runtime (e.g., for
+// SCM::r_set_integrate_internals), without going through R.
+typedef double PlantPlus_internals::* PlantPlus_internals_member;
+PlantPlus_internals_member plant_plus_internals_member(const std::string& name);
+std::vector<PlantPlus_internals_member>
+plant_plus_internals_members(const std::vector<std::string>& names);
+
 }
 
 #endif
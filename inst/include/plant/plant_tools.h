@@ -9,10 +9,17 @@ namespace plant {
 namespace tools {
 Environment fixed_environment(double canopy_openness,
                               double height_max=150.0);
+// An environment with no light environment (so full light, unless
+// set with Environment::set_fixed_canopy_openness).
+Environment fixed_environment();
+
+// Net mass production increases with canopy openness, so if it is
+// positive in full light it has a single root on [0, 1].
 template <typename T>
 double lcp_whole_plant(PlantPlus<T> p) {
+  Environment env = fixed_environment();
   auto target = [&] (double x) mutable -> double {
-    Environment env = fixed_environment(x);
+    env.set_fixed_canopy_openness(x);
     p.compute_vars_phys(env);
     return p.net_mass_production_dt();
   };
@@ -26,6 +33,144 @@ double lcp_whole_plant(PlantPlus<T> p) {
     return util::uniroot(target, 0.0, 1.0, tol, max_iterations);
   }
 }
+
+// Batch version of the above, over a set of strategies, with plants
+// of a given height (NA_REAL for the seedling height).
+template <typename T>
+std::vector<double> lcp_whole_plants(const std::vector<T>& strategies,
+                                     double height) {
+  std::vector<double> ret;
+  for (const auto& s : strategies) {
+    PlantPlus<T> p = make_plant_plus(s);
+    if (util::is_finite(height)) {
+      p.set_height(height);
+    }
+    ret.push_back(lcp_whole_plant(p));
+  }
+  return ret;
+}
+
+// Times at which a plant growing in a fixed environment reaches each
+// of 'sizes' (which must be increasing) of the size variable
+// 'size_name'.  This does the same job as grow_plant_to_size in R,
+// but integrates the plant only once.  Any internal variable with a
+// rate (i.e., a matching '<size_name>_dt' variable, such as "height",
+// "area_leaf" or "mass_above_ground") can be used.  A crossing within
+// a step is located on the cubic Hermite interpolant of size over the
+// step (from the sizes and rates at either end) and then polished by
+// a few Newton iterations, each of which re-steps from the start of
+// the step.
+//
+// Sizes that are not reached (before time_max, before growth stops
+// or before the integration fails) and sizes below the initial size
+// of the plant get NA_REAL.
+template <typename T>
+std::vector<double> grow_plant_to_size_times(PlantPlus<T> plant,
+                                             const std::vector<double>& sizes,
+                                             const std::string& size_name,
+                                             const Environment& environment,
+                                             double time_max) {
+  typedef ode::Runner<PlantRunner<T> > runner_type;
+  const PlantPlus_internals_member
+    size = plant_plus_internals_member(size_name),
+    size_dt = plant_plus_internals_member(size_name + "_dt");
+  const size_t n = sizes.size(), max_polish = 5;
+  const double eps = 1e-10;
+  std::vector<double> ret(n, NA_REAL);
+
+  runner_type runner(PlantRunner<T>(plant, environment), ode::OdeControl());
+  runner_type detail = runner;
+  // Stop the last step at time_max, so that sizes first reached
+  // after it are left as NA.
+  if (util::is_finite(time_max)) {
+    runner.set_time_max(std::max(time_max, runner.time()));
+  }
+
+  const PlantPlus_internals vars0 = runner.obj.plant.r_internals();
+  double t0 = runner.time(), h0 = vars0.*size, dh0 = vars0.*size_dt;
+  ode::state_type y0 = runner.state();
+
+  size_t i = 0;
+  while (i < n && sizes[i] < h0) {
+    ++i;
+  }
+  while (i < n && sizes[i] == h0) {
+    ret[i++] = t0;
+  }
+
+  while (i < n && t0 < time_max && dh0 > 0.0) {
+    try {
+      runner.step();
+    } catch (const std::exception&) {
+      break;
+    }
+    const PlantPlus_internals vars = runner.obj.plant.r_internals();
+    const double t1 = runner.time(), h1 = vars.*size, dh1 = vars.*size_dt,
+      dt = t1 - t0;
+
+    for (; i < n && sizes[i] <= h1; ++i) {
+      const double target = sizes[i];
+      // Bisect the Hermite interpolant, on s = (t - t0) / dt in [0, 1]
+      auto hermite = [&] (double s) -> double {
+        const double s2 = s * s, s3 = s2 * s;
+        return (2 * s3 - 3 * s2 + 1) * h0 + (s3 - 2 * s2 + s) * dt * dh0 +
+          (-2 * s3 + 3 * s2) * h1 + (s3 - s2) * dt * dh1;
+      };
+      double lo = 0.0, hi = 1.0;
+      for (size_t j = 0; j < 40; ++j) {
+        const double mid = (lo + hi) / 2;
+        if (hermite(mid) < target) {
+          lo = mid;
+        } else {
+          hi = mid;
+        }
+      }
+      double t = t0 + hi * dt;
+
+      // Newton polish against the actual solution
+      for (size_t j = 0; j < max_polish && t > t0; ++j) {
+        detail.set_state(y0, t0);
+        detail.step_to(t);
+        const PlantPlus_internals detail_vars = detail.obj.plant.r_internals();
+        const double err = detail_vars.*size - target;
+        if (std::abs(err) < eps * target) {
+          break;
+        }
+        t = util::clamp(t - err / detail_vars.*size_dt, t0, t1);
+      }
+      ret[i] = t;
+    }
+
+    t0 = t1;
+    h0 = h1;
+    dh0 = dh1;
+    y0 = runner.state();
+  }
+
+  return ret;
+}
+
+// Batch version of the above, over a set of strategies; returns a
+// vector of times for each.
+template <typename T>
+std::vector<std::vector<double> >
+grow_plants_to_size_times(const std::vector<T>& strategies,
+                          const std::vector<double>& sizes,
+                          const std::string& size_name,
+                          const Environment& environment,
+                          double time_max) {
+  if (sizes.empty() || !std::is_sorted(sizes.begin(), sizes.end())) {
+    util::stop("sizes must be non-empty and sorted");
+  }
+  std::vector<std::vector<double> > ret;
+  for (const auto& s : strategies) {
+    ret.push_back(grow_plant_to_size_times(make_plant_plus(s), sizes,
+                                           size_name, environment,
+                                           time_max));
+  }
+  return ret;
+}
+
 }
 
 // These are only here because I really want somewhere after the Rcpp
@@ -44,6 +189,29 @@ Plant<T> plant_plus_to_plant(PlantPlus<T> p) {
   return p.to_plant();
 }
 
+// Run the SCM, collecting the errors used to refine the cohort
+// schedule (see build_schedule and SCM::run_error); the leaf area
+// errors are returned with a row per introduction and a column per
+// cohort.
+template <typename T>
+Rcpp::List run_scm_error(SCM<T>& scm) {
+  std::vector<std::vector<std::vector<double> > > area_leaf_error;
+  std::vector<std::vector<double> > total;
+  scm.run_error(area_leaf_error, total);
+
+  Rcpp::List lai;
+  for (const auto& m : area_leaf_error) {
+    lai.push_back(m.empty() ? Rcpp::NumericMatrix(0, 0) :
+                  util::to_rcpp_matrix(m));
+  }
+  using namespace Rcpp;
+  return List::create(_["seed_rain"] = scm.seed_rains(),
+                      _["err"] = List::create(_["lai"] = lai,
+                                              _["seed_rain"] = scm.r_seed_rain_error(),
+                                              _["total"] = total),
+                      _["ode_times"] = scm.r_ode_times());
+}
+
 }
 
 #endif
@@ -19,6 +19,10 @@ public:
 
   template <typename Function>
   double integrate(Function f, double a, double b);
+  // As above, but with both tolerances multiplied by tol_scale, so
+  // that callers can trade accuracy for speed on a per-call basis.
+  template <typename Function>
+  double integrate(Function f, double a, double b, double tol_scale);
   template <typename Function>
   double integrate_with_intervals(Function f, intervals_type intervals);
   template <typename Function>
@@ -31,6 +35,17 @@ public:
 
   bool is_adaptive() const {return adaptive;}
 
+  // Points and weights of the underlying Gauss-Kronrod rule over
+  // [a, b].  For a non-adaptive integrator, integrate(f, a, b) is
+  // sum(w * f(x)), so callers that integrate many functions over the
+  // same interval can precompute anything that depends only on x.
+  std::vector<double> integrate_vector_x(double a, double b) const {
+    return q.integrate_vector_x(a, b);
+  }
+  std::vector<double> integrate_vector_w(double a, double b) const {
+    return q.integrate_vector_w(a, b);
+  }
+
   // * R interface.  These avoid referencing full Rcpp types until
   // implementation in qag.cpp.
   double r_integrate(SEXP f, double a, double b);
@@ -59,6 +74,7 @@ private:
   size_t limit;
   double epsabs;
   double epsrel;
+  double tol_scale;
 
   // Intermediates
   double area, error;
@@ -68,6 +84,12 @@ private:
 
 template <typename Function>
 double QAG::integrate(Function f, double a, double b) {
+  return integrate(f, a, b, 1.0);
+}
+
+template <typename Function>
+double QAG::integrate(Function f, double a, double b, double tol_scale_) {
+  tol_scale = tol_scale_;
   return adaptive ? integrate_adaptive(f, a, b) : integrate_fixed(f, a, b);
 }
 
@@ -111,6 +133,7 @@ double QAG::integrate_with_intervals(Function f,
     b     = intervals[1].begin(),
     a_end = intervals[0].end();
   w.clear();
+  w.reserve(intervals[0].size());
   while (a != a_end) {
     w.push_back(do_integrate(f, *a, *b));
     ++a;
@@ -121,16 +144,24 @@ double QAG::integrate_with_intervals(Function f,
   return area;
 }
 
+// The stored intervals are rescaled and reintegrated in place, so
+// this allocates nothing.
 template <typename Function>
 double QAG::integrate_with_last_intervals(Function f,
                                           double a, double b) {
-  intervals_type intervals = w.get_intervals();
-  if (intervals[0].empty()) {
+  if (w.empty()) {
     util::stop("No stored intervals to use");
   }
-  intervals_type intervals_scaled =
-    internal::rescale_intervals(intervals, a, b);
-  return integrate_with_intervals(f, intervals_scaled);
+  if (!adaptive) {
+    util::stop("This really does not make any sense...");
+  }
+  w.rescale(a, b);
+  for (internal::workspace::points_iter p = w.begin(); p != w.end(); ++p) {
+    *p = do_integrate(f, p->a, p->b);
+  }
+  area  = w.total_area();
+  error = w.total_error();
+  return area;
 }
 
 template <typename Function>
@@ -149,11 +180,16 @@ bool QAG::initialise(Function f, double a, double b) {
   const double resabs = q.get_last_area_abs();
   const double resasc = q.get_last_area_asc();
   // Limits for checking against:
-  const double tolerance = std::max(epsabs, epsrel * std::abs(area));
+  const double tolerance =
+    tol_scale * std::max(epsabs, epsrel * std::abs(area));
   const double round_off =
     50 * std::numeric_limits<double>::epsilon() * resabs;
 
   w.clear();
+  // Each refinement replaces one interval with two, so this is all
+  // the space that the workspace can need (a no-op after first use;
+  // copies of a QAG do not carry capacity with them).
+  w.reserve(limit);
   w.push_back(p);
 
   roundoff_type1 = 0;
@@ -194,7 +230,8 @@ bool QAG::refine(Function f) {
 
   area  += area12  - p0.area;
   error += error12 - p0.error;
-  const double tolerance = std::max(epsabs, epsrel * std::abs(area));
+  const double tolerance =
+    tol_scale * std::max(epsabs, epsrel * std::abs(area));
 
   // Update roundoff calculations
   if (!util::identical(resasc1, error1) && !util::identical(resasc2, error2)) {
@@ -3,7 +3,7 @@
 #define PLANT_PLANT_QAG_INTERNALS_H_
 
 #include <vector>
-#include <list>
+#include <cstddef>
 
 namespace plant {
 namespace quadrature {
@@ -11,6 +11,13 @@ typedef std::vector<std::vector<double> > intervals_type;
 
 namespace internal {
 
+// Subintervals of an adaptive integration.  During refinement
+// (QAG::refine) the points are kept as a max-heap on their error, so
+// the worst point is always at the front and is replaced in
+// logarithmic time.  Points added with push_back are stored in the
+// order given, and the heap order is only established by
+// initialisation from a single point; this keeps intervals in the
+// order that they were passed in by QAG::integrate_with_intervals.
 class workspace {
 public:
   class point {
@@ -22,12 +29,14 @@ public:
     double area;
     double error;
   };
-  typedef std::list<point>::iterator points_iter;
-  typedef std::list<point>::const_iterator points_const_iter;
+  typedef std::vector<point>::iterator points_iter;
+  typedef std::vector<point>::const_iterator points_const_iter;
 
   void clear();
+  void reserve(size_t n);
+  bool empty() const {return points.empty();}
 
-  point worst_point() const;
+  const point& worst_point() const;
   void update(point el1, point el2);
 
   double total_area() const;
@@ -36,16 +45,17 @@ public:
   void push_back(point el);
   intervals_type get_intervals() const;
 
+  // Map the stored intervals linearly from their current range onto
+  // [min, max], in place; the areas and errors are left untouched
+  // so need recomputing.
+  void rescale(double min, double max);
+  points_iter begin() {return points.begin();}
+  points_iter end()   {return points.end();}
+
 private:
-  void insert_forward(point el);
-  void insert_backward(point el);
-  void drop_worst();
-  points_iter search_forward(double error);
-  points_iter search_backward(double error);
-  std::list<point> points;
+  std::vector<point> points;
 };
 
-intervals_type rescale_intervals(intervals_type x, double min, double max);
 void print_intervals(intervals_type x);
 
 }
@@ -2,6 +2,7 @@
 #ifndef PLANT_PLANT_QK_H_
 #define PLANT_PLANT_QK_H_
 
+#include <plant/qk_rules.h>
 #include <vector>
 #include <cmath> // std::abs
 #include <RcppCommon.h> // SEXP
@@ -9,105 +10,172 @@
 namespace plant {
 namespace quadrature {
 
-// Gauss-Kronrod Quadrature -- ported from GSL
-class QK {
-public:
-  QK(size_t rule);
-  template <typename Function>
-  double integrate(Function f, double a, double b);
-
-  // These two provide very low level access to the integration
-  // routines.
-  std::vector<double> integrate_vector_x(double a, double b) const;
-  double integrate_vector(const std::vector<double>& y,
-                          double a, double b);
-
-  double get_last_area()     const {return last_result;    }
-  double get_last_error()    const {return last_error;     }
-  double get_last_area_abs() const {return last_result_abs;}
-  double get_last_area_asc() const {return last_result_asc;}
+namespace internal {
 
-  // * R interface
-  double r_integrate(SEXP f, double a, double b);
-
-private:
-  void initialise(size_t rule);
-  static double rescale_error(double err, double result_abs,
-                              double result_asc);
+struct qk_result {
+  double area;
+  double area_abs;
+  double area_asc;
+  double error;
+};
 
-  double last_result;
-  double last_result_abs;
-  double last_result_asc;
-  double last_error;
+double qk_rescale_error(double err, double result_abs, double result_asc);
 
-  size_t n;
-  std::vector<double> fv1;
-  std::vector<double> fv2;
-  std::vector<double> xgk, wg, wgk;
-};
+// Gauss-Kronrod kernel for a single rule (one of QK15, ..., QK61).
+// The loop bounds and the rule tables are compile time constants, and
+// the scratch space lives on the stack, so that the compiler can
+// unroll this completely.  'f' is evaluated at the points in the same
+// order as QK::integrate_vector_x returns them.
+template <typename Rule, typename Function>
+qk_result qk_fixed(Function& f, double a, double b) {
+  const size_t n = Rule::n;
+  double fv1[n], fv2[n];
 
-// Skipping dealing with Functors by just requiring something
-// callable using templates.
-template <typename Function>
-double QK::integrate(Function f, double a, double b) {
   const double center          = 0.5 * (a + b);
   const double half_length     = 0.5 * (b - a);
   const double abs_half_length = std::abs(half_length);
   const double f_center        = f(center);
 
   double result_gauss = 0;
-  double result_kronrod = f_center * wgk[n - 1];
+  double result_kronrod = f_center * Rule::wgk[n - 1];
   double result_abs = std::abs(result_kronrod);
 
   if (n % 2 == 0) {
-    result_gauss = f_center * wg[n / 2 - 1];
+    result_gauss = f_center * Rule::wg[n / 2 - 1];
   }
 
   for (size_t j = 0; j < (n - 1) / 2; j++) {
     const size_t jtw = j * 2 + 1;  /* in original fortran j=1,2,3 jtw=2,4,6 */
-    const double abscissa = half_length * xgk[jtw];
+    const double abscissa = half_length * Rule::xgk[jtw];
     const double fval1 = f(center - abscissa);
     const double fval2 = f(center + abscissa);
     const double fsum = fval1 + fval2;
     fv1[jtw] = fval1;
     fv2[jtw] = fval2;
-    result_gauss   += wg[j] * fsum;
-    result_kronrod += wgk[jtw] * fsum;
-    result_abs     += wgk[jtw] * (std::abs(fval1) + std::abs(fval2));
+    result_gauss   += Rule::wg[j] * fsum;
+    result_kronrod += Rule::wgk[jtw] * fsum;
+    result_abs     += Rule::wgk[jtw] * (std::abs(fval1) + std::abs(fval2));
   }
 
   for (size_t j = 0; j < n / 2; j++) {
-    size_t jtwm1 = j * 2;
-    const double abscissa = half_length * xgk[jtwm1];
+    const size_t jtwm1 = j * 2;
+    const double abscissa = half_length * Rule::xgk[jtwm1];
     const double fval1 = f(center - abscissa);
     const double fval2 = f(center + abscissa);
     fv1[jtwm1] = fval1;
     fv2[jtwm1] = fval2;
-    result_kronrod += wgk[jtwm1] * (fval1 + fval2);
-    result_abs     += wgk[jtwm1] * (std::abs(fval1) + std::abs(fval2));
-  };
+    result_kronrod += Rule::wgk[jtwm1] * (fval1 + fval2);
+    result_abs     += Rule::wgk[jtwm1] * (std::abs(fval1) + std::abs(fval2));
+  }
 
   const double mean = result_kronrod * 0.5;
 
-  double result_asc = wgk[n - 1] * std::abs(f_center - mean);
+  double result_asc = Rule::wgk[n - 1] * std::abs(f_center - mean);
 
   for (size_t j = 0; j < n - 1; j++) {
-    result_asc += wgk[j] * (std::abs(fv1[j] - mean) +
-                            std::abs(fv2[j] - mean));
+    result_asc += Rule::wgk[j] * (std::abs(fv1[j] - mean) +
+                                  std::abs(fv2[j] - mean));
   }
 
   /* scale by the width of the integration region */
 
   const double err = (result_kronrod - result_gauss) * half_length;
 
-  result_kronrod *= half_length;
-  result_abs *= abs_half_length;
-  result_asc *= abs_half_length;
+  qk_result ret;
+  ret.area     = result_kronrod * half_length;
+  ret.area_abs = result_abs * abs_half_length;
+  ret.area_asc = result_asc * abs_half_length;
+  ret.error    = qk_rescale_error(err, ret.area_abs, ret.area_asc);
+  return ret;
+}
+
+// Feeds precomputed function values to qk_fixed, ignoring x.
+class qk_values {
+public:
+  qk_values(std::vector<double>::const_iterator it_) : it(it_) {}
+  double operator()(double /* x */) {return *it++;}
+private:
+  std::vector<double>::const_iterator it;
+};
+
+}
+
+// Gauss-Kronrod Quadrature -- ported from GSL.  The rule is chosen at
+// run time, but each rule has its own fixed size kernel (see
+// internal::qk_fixed above), so a QK holds no tables of its own and
+// is cheap to copy.
+class QK {
+public:
+  QK(size_t rule);
+  template <typename Function>
+  double integrate(Function f, double a, double b);
+
+  // These two provide very low level access to the integration
+  // routines.
+  std::vector<double> integrate_vector_x(double a, double b) const;
+  std::vector<double> integrate_vector_w(double a, double b) const;
+  double integrate_vector(const std::vector<double>& y,
+                          double a, double b);
+
+  double get_last_area()     const {return last_result;    }
+  double get_last_error()    const {return last_error;     }
+  double get_last_area_abs() const {return last_result_abs;}
+  double get_last_area_asc() const {return last_result_asc;}
+
+  // * R interface
+  double r_integrate(SEXP f, double a, double b);
+
+private:
+  template <typename Function>
+  double run(Function& f, double a, double b);
+
+  double last_result;
+  double last_result_abs;
+  double last_result_asc;
+  double last_error;
+
+  size_t rule;
+  // Size and tables of the rule, for the (non-critical) node and
+  // weight accessors; these point at the static tables in qk_rules.h
+  size_t n;
+  const double *xgk, *wgk;
+};
+
+// Skipping dealing with Functors by just requiring something
+// callable using templates.
+template <typename Function>
+double QK::integrate(Function f, double a, double b) {
+  return run(f, a, b);
+}
+
+template <typename Function>
+double QK::run(Function& f, double a, double b) {
+  internal::qk_result res;
+  switch (rule) {
+  case 15:
+    res = internal::qk_fixed<QK15>(f, a, b);
+    break;
+  case 21:
+    res = internal::qk_fixed<QK21>(f, a, b);
+    break;
+  case 31:
+    res = internal::qk_fixed<QK31>(f, a, b);
+    break;
+  case 41:
+    res = internal::qk_fixed<QK41>(f, a, b);
+    break;
+  case 51:
+    res = internal::qk_fixed<QK51>(f, a, b);
+    break;
+  default: // 61; checked on construction
+    res = internal::qk_fixed<QK61>(f, a, b);
+    break;
+  }
 
-  last_result     = result_kronrod;
-  last_result_abs = result_abs;
-  last_result_asc = result_asc;
-  last_error      = rescale_error(err, result_abs, result_asc);
+  last_result     = res.area;
+  last_result_abs = res.area_abs;
+  last_result_asc = res.area_asc;
+  last_error      = res.error;
 
   return last_result;
 }
@@ -23,6 +23,8 @@ public:
 
   void run();
   std::vector<size_t> run_next();
+  void run_error(std::vector<std::vector<std::vector<double> > >& area_leaf_error,
+                 std::vector<std::vector<double> >& total);
 
   double time() const;
   void reset();
@@ -52,15 +54,67 @@ public:
   CohortSchedule r_cohort_schedule() const {return cohort_schedule;}
   void r_set_cohort_schedule(CohortSchedule x);
   void r_set_cohort_schedule_times(std::vector<std::vector<double> > x);
+  void r_set_seed_rain(std::vector<double> x);
+
+  // * Emergent properties, collected as the SCM runs
+  void r_set_integrate_internals(std::vector<std::string> names);
+  std::vector<double> r_integrate_internals_time() const {
+    return integrate_time;
+  }
+  std::vector<std::vector<double> >
+  r_integrate_internals_total(util::index species_index) const;
+  std::vector<std::vector<double> >
+  r_integrate_internals_cumulative(util::index species_index) const;
+
+  // * Seed rain under other disturbance regimes, from one run
+  void r_set_record_seeds(bool record);
+  std::vector<double> r_seed_rain_record_time() const {
+    return record_time;
+  }
+  std::vector<std::vector<double> >
+  r_seed_rain_disturbance(std::vector<double> mean_interval) const;
+  std::vector<double> r_seed_rain_survival(std::vector<double> pr_survival,
+                                           double mean_interval) const;
 
 private:
   double seed_rain_total() const;
+  std::vector<double> introduction_times(size_t species_index) const;
   std::vector<double> seed_rain_cohort(size_t species_index) const;
+  double seed_rain_integrate(const std::vector<double>& times,
+                             const std::vector<double>& seeds) const;
+  std::vector<double>
+  seed_rain_integration_error(const std::vector<double>& times,
+                              const std::vector<double>& seeds,
+                              double scal) const;
+  void integrate_internals();
+  void integrate_internals_cumulative(const std::vector<double>& total,
+                                      std::vector<double>& cumulative) const;
+  void record_seeds();
+  bool remaining_seed_rain_small();
+  std::vector<double>
+  seed_rain_given_survival(const std::vector<double>& pr_survival,
+                           double mean_interval) const;
 
   parameters_type parameters;
   patch_type patch;
   CohortSchedule cohort_schedule;
   ode::Solver<patch_type> solver;
+
+  std::vector<PlantPlus_internals_member> integrate_members;
+  std::vector<double> integrate_time, integrate_patch_density;
+  // Indexed by [species][variable][time]
+  std::vector<std::vector<std::vector<double> > > integrate_total;
+  std::vector<std::vector<std::vector<double> > > integrate_cumulative;
+
+  bool record_seeds_enabled;
+  std::vector<double> record_time;
+  // Indexed by [species][time][cohort]
+  std::vector<std::vector<std::vector<double> > > record_seeds_value;
+
+  // Seed production rate at the last introduction, and the number of
+  // introductions over which it has declined in a row, per species
+  std::vector<double> seed_rain_rate_last;
+  std::vector<size_t> seed_rain_rate_declines;
 };
 
 template <typename T>
@@ -68,7 +122,8 @@ SCM<T>::SCM(parameters_type p)
   : parameters(p),
     patch(parameters),
     cohort_schedule(make_cohort_schedule(parameters)),
-    solver(patch, make_ode_control(p.control)) {
+    solver(patch, make_ode_control(p.control)),
+    record_seeds_enabled(false) {
   parameters.validate();
   if (!util::identical(parameters.patch_area, 1.0)) {
     util::stop("Patch area must be exactly 1 for the SCM");
@@ -110,10 +165,76 @@ std::vector<size_t> SCM<T>::run_next() {
   } else {
     solver.advance(patch, e.time_end());
   }
+  integrate_internals();
+  record_seeds();
+
+  // Skip the remaining introductions (see remaining_seed_rain_small);
+  // the seed rain is then integrated over the cohorts introduced.
+  if (!complete() && remaining_seed_rain_small()) {
+    while (!complete()) {
+      cohort_schedule.pop();
+    }
+  }
 
   return ret;
 }
 
+// Run the SCM, collecting the errors used to refine the cohort
+// schedule.  After each introduction, the leaf area error of every
+// cohort of the introduced species is recorded; area_leaf_error is
+// indexed by [species][cohort][introduction] (NA where a cohort did
+// not yet exist).  The total error for each cohort is the largest of
+// these and its seed rain error (-Inf if all are missing).
+template <typename T>
+void SCM<T>::run_error(std::vector<std::vector<std::vector<double> > >& area_leaf_error,
+                       std::vector<std::vector<double> >& total) {
+  reset();
+  const size_t n_spp = patch.size();
+  std::vector<size_t> n_introduced(n_spp, 0);
+  area_leaf_error.clear();
+  for (size_t i = 0; i < n_spp; ++i) {
+    const size_t n = cohort_schedule.times(i).size();
+    area_leaf_error.push_back(std::vector<std::vector<double> >
+                              (n, std::vector<double>(n, NA_REAL)));
+  }
+
+  while (!complete()) {
+    for (auto idx : run_next()) {
+      const std::vector<double> err = patch.r_area_leaf_error(idx);
+      std::vector<std::vector<double> >& m = area_leaf_error[idx];
+      const size_t row = n_introduced[idx]++;
+      if (err.size() > m.size() || (!m.empty() && row >= m.front().size())) {
+        util::stop("Unexpected introduction while collecting errors");
+      }
+      for (size_t j = 0; j < err.size(); ++j) {
+        m[j][row] = err[j];
+      }
+    }
+  }
+
+  const double tot_seed_out = seed_rain_total();
+  total.clear();
+  for (size_t i = 0; i < n_spp; ++i) {
+    std::vector<double> x =
+      seed_rain_integration_error(introduction_times(i),
+                                  seed_rain_cohort(i), tot_seed_out);
+    // Introductions skipped by ending the run early are never refined
+    x.resize(cohort_schedule.times(i).size(), NA_REAL);
+    for (size_t j = 0; j < x.size(); ++j) {
+      double& x_j = x[j];
+      if (std::isnan(x_j)) {
+        x_j = R_NegInf;
+      }
+      for (auto e : area_leaf_error[i][j]) {
+        if (!std::isnan(e) && e > x_j) {
+          x_j = e;
+        }
+      }
+    }
+    total.push_back(x);
+  }
+}
+
 template <typename T>
 double SCM<T>::time() const {
   return patch.time();
@@ -127,7 +248,23 @@ template <typename T>
 void SCM<T>::reset() {
   patch.reset();
   cohort_schedule.reset();
+  for (size_t i = 0; i < patch.size(); ++i) {
+    patch.reserve(i, cohort_schedule.times(i).size());
+  }
   solver.reset(patch);
+
+  integrate_time.clear();
+  integrate_patch_density.clear();
+  integrate_total.clear();
+  integrate_cumulative.clear();
+  integrate_internals();
+
+  record_time.clear();
+  record_seeds_value.clear();
+  record_seeds();
+
+  seed_rain_rate_last.assign(patch.size(), 0.0);
+  seed_rain_rate_declines.assign(patch.size(), 0);
 }
 
 template <typename T>
@@ -137,8 +274,8 @@ bool SCM<T>::complete() const {
 
 template <typename T>
 double SCM<T>::seed_rain(size_t species_index) const {
-  return util::trapezium(cohort_schedule.times(species_index),
-                         seed_rain_cohort(species_index));
+  return seed_rain_integrate(introduction_times(species_index),
+                             seed_rain_cohort(species_index));
 }
 
 template <typename T>
@@ -172,9 +309,9 @@ std::vector<double> SCM<T>::r_seed_rain_error(util::index species_index) const {
   // all the errors I think? (see TODO in class definition)
   double tot_seed_out = seed_rain_total();
   const size_t idx = species_index.check_bounds(patch.size());
-  return util::local_error_integration(cohort_schedule.times(idx),
-                                       seed_rain_cohort(idx),
-                                       tot_seed_out);
+  return seed_rain_integration_error(introduction_times(idx),
+                                     seed_rain_cohort(idx),
+                                     tot_seed_out);
 }
 
 template <typename T>
@@ -182,9 +319,9 @@ std::vector<std::vector<double> > SCM<T>::r_seed_rain_error() const {
   std::vector<std::vector<double> > ret;
   double tot_seed_out = seed_rain_total();
   for (size_t i = 0; i < patch.size(); ++i) {
-    ret.push_back(util::local_error_integration(cohort_schedule.times(i),
-                                                seed_rain_cohort(i),
-                                                tot_seed_out));
+    ret.push_back(seed_rain_integration_error(introduction_times(i),
+                                              seed_rain_cohort(i),
+                                              tot_seed_out));
   }
   return ret;
 }
@@ -236,6 +373,287 @@ void SCM<T>::r_set_cohort_schedule_times(std::vector<std::vector<double> > x) {
   parameters.cohort_schedule_times = x;
 }
 
+// This allows an SCM object to be reused with a different seed rain
+// (e.g., through the iterations of an equilibrium search) without
+// building a new one, which means converting and validating the
+// Parameters all over again.
+template <typename T>
+void SCM<T>::r_set_seed_rain(std::vector<double> x) {
+  if (patch.ode_size() > 0) {
+    util::stop("Cannot set seed rain without resetting first");
+  }
+  util::check_length(x.size(), patch.size());
+  parameters.seed_rain = x;
+  patch = patch_type(parameters);
+  solver.reset(patch);
+}
+
+// Variables from PlantPlus_internals to total over each species'
+// size distribution after every introduction (see
+// Species::integrate_internals), along with the running integral of
+// these totals over patch age, weighted by the patch age
+// distribution.  This avoids reconstructing the patch at every time
+// afterwards.  Setting the variables resets the SCM.
+template <typename T>
+void SCM<T>::r_set_integrate_internals(std::vector<std::string> names) {
+  integrate_members = plant_plus_internals_members(names);
+  reset();
+}
+
+template <typename T>
+std::vector<std::vector<double> >
+SCM<T>::r_integrate_internals_total(util::index species_index) const {
+  if (integrate_members.empty()) {
+    return std::vector<std::vector<double> >();
+  }
+  return integrate_total[species_index.check_bounds(patch.size())];
+}
+
+template <typename T>
+std::vector<std::vector<double> >
+SCM<T>::r_integrate_internals_cumulative(util::index species_index) const {
+  if (integrate_members.empty()) {
+    return std::vector<std::vector<double> >();
+  }
+  return integrate_cumulative[species_index.check_bounds(patch.size())];
+}
+
+template <typename T>
+void SCM<T>::integrate_internals() {
+  if (integrate_members.empty()) {
+    return;
+  }
+  const size_t n_spp = patch.size(), n_var = integrate_members.size();
+  const double time = patch.time();
+  const double density = patch.disturbance_regime().density(time);
+  if (integrate_time.empty()) {
+    integrate_total.resize(n_spp, std::vector<std::vector<double> >(n_var));
+    integrate_cumulative.resize(n_spp, std::vector<std::vector<double> >(n_var));
+  }
+  integrate_time.push_back(time);
+  integrate_patch_density.push_back(density);
+  for (size_t i = 0; i < n_spp; ++i) {
+    const std::vector<double> x = patch.integrate_internals(i, integrate_members);
+    for (size_t j = 0; j < n_var; ++j) {
+      integrate_total[i][j].push_back(x[j]);
+      integrate_internals_cumulative(integrate_total[i][j],
+                                     integrate_cumulative[i][j]);
+    }
+  }
+}
+
+// Extends the running integral of a total over patch age, weighted
+// by the patch age distribution, to the time just added; the rule is
+// the one used for the seed rain (see seed_rain_integrate).  With
+// local cubic interpolation the newest interval is integrated with a
+// quadratic until the next time is added, when it is revised, so that
+// the final value is the integral over all times.
+template <typename T>
+void SCM<T>::integrate_internals_cumulative(const std::vector<double>& total,
+                                            std::vector<double>& cumulative) const {
+  const std::vector<double>& t = integrate_time;
+  const size_t n = t.size();
+  auto w = [&] (size_t k) {return integrate_patch_density[k] * total[k];};
+  if (n == 1) {
+    cumulative.push_back(0.0);
+    return;
+  }
+  if (!parameters.control.cohort_integration_cubic) {
+    cumulative.push_back(cumulative.back() +
+                         (t[n - 1] - t[n - 2]) * (w(n - 2) + w(n - 1)) / 2);
+    return;
+  }
+  // Integral over [t[k], t[k + 1]] using all neighbours available:
+  auto interval = [&] (size_t k) {
+    const bool has_0 = k > 0, has_3 = k + 2 < n;
+    return util::integrate_interval_local(has_0,
+                                          has_0 ? t[k - 1] : 0.0,
+                                          has_0 ? w(k - 1) : 0.0,
+                                          t[k], w(k), t[k + 1], w(k + 1),
+                                          has_3,
+                                          has_3 ? t[k + 2] : 0.0,
+                                          has_3 ? w(k + 2) : 0.0);
+  };
+  if (n > 2) {
+    cumulative[n - 2] = cumulative[n - 3] + interval(n - 3);
+  }
+  cumulative.push_back(cumulative[n - 2] + interval(n - 2));
+}
+
+// Growth and light competition within a patch do not depend on the
+// disturbance regime, which enters only through the weighting of
+// seed production by patch survival and through the patch age
+// distribution.  With recording enabled, the (survival weighted)
+// seed output of every cohort is recorded after each introduction so
+// that the seed rain under other disturbance regimes can be computed
+// afterwards without rerunning the SCM.  Setting this resets the SCM.
+template <typename T>
+void SCM<T>::r_set_record_seeds(bool record) {
+  record_seeds_enabled = record;
+  reset();
+}
+
+// Seed rain for each species (per row) for each of a set of mean
+// disturbance intervals, using the Weibull regime of Disturbance.
+template <typename T>
+std::vector<std::vector<double> >
+SCM<T>::r_seed_rain_disturbance(std::vector<double> mean_interval) const {
+  std::vector<std::vector<double> > ret;
+  for (auto m : mean_interval) {
+    const Disturbance d(m);
+    std::vector<double> pr_survival;
+    for (auto t : record_time) {
+      pr_survival.push_back(d.pr_survival(t));
+    }
+    ret.push_back(seed_rain_given_survival(pr_survival, m));
+  }
+  return ret;
+}
+
+// As above, for an arbitrary patch survival curve, evaluated at the
+// recorded times (seed_rain_record_time), with mean interval (the
+// integral of the survival curve) 'mean_interval'.
+template <typename T>
+std::vector<double>
+SCM<T>::r_seed_rain_survival(std::vector<double> pr_survival,
+                             double mean_interval) const {
+  util::check_length(pr_survival.size(), record_time.size());
+  return seed_rain_given_survival(pr_survival, mean_interval);
+}
+
+template <typename T>
+void SCM<T>::record_seeds() {
+  if (!record_seeds_enabled) {
+    return;
+  }
+  const size_t n_spp = patch.size();
+  record_seeds_value.resize(n_spp);
+  for (size_t i = 0; i < n_spp; ++i) {
+    record_seeds_value[i].push_back(patch.at(i).seeds());
+  }
+  record_time.push_back(patch.time());
+}
+
+// A cohort introduced at t_i has accumulated seeds
+//   S_i(t) = int_{t_i}^t f(s) P(s) ds / P(t_i)
+// under the patch survival P of this run, and contributes
+//   P(t_i) / m * S_i(T)
+// to the seed rain (P / m being the patch age density).  Under another
+// survival curve Q with mean m', the contribution is
+//   P(t_i) / m' * int_{t_i}^T Q(s) / P(s) dS_i(s)
+// The inner integral is computed by the trapezium rule over the
+// recorded times.
+// This reuses the integral of the (rapidly changing) seed output
+// computed by the ODE solver and approximates only the smooth ratio
+// Q / P, so it is exact when Q == P.  Note that the cohort schedule
+// (including its end time) is that of the regime used in the run.
+template <typename T>
+std::vector<double>
+SCM<T>::seed_rain_given_survival(const std::vector<double>& pr_survival,
+                                 double mean_interval) const {
+  if (!record_seeds_enabled) {
+    util::stop("Seed recording is not enabled");
+  }
+  if (!complete()) {
+    util::stop("SCM has not been run to completion");
+  }
+  const Disturbance& disturbance_regime = patch.disturbance_regime();
+  const size_t n_time = record_time.size();
+  std::vector<double> ratio;
+  for (size_t k = 0; k < n_time; ++k) {
+    ratio.push_back(pr_survival[k] /
+                    disturbance_regime.pr_survival(record_time[k]));
+  }
+
+  std::vector<double> ret;
+  for (size_t i = 0; i < patch.size(); ++i) {
+    const std::vector<double> times = introduction_times(i);
+    const std::vector<std::vector<double> >& seeds = record_seeds_value[i];
+    std::vector<double> value(times.size(), 0.0);
+    for (size_t k = 1; k < n_time; ++k) {
+      const double r = (ratio[k - 1] + ratio[k]) / 2;
+      const std::vector<double>& s0 = seeds[k - 1], & s1 = seeds[k];
+      for (size_t j = 0; j < s1.size(); ++j) {
+        const double ds = s1[j] - (j < s0.size() ? s0[j] : 0.0);
+        value[j] += r * ds;
+      }
+    }
+    const double scal = parameters.strategies[i].S_D *
+      parameters.seed_rain[i] / mean_interval;
+    for (size_t j = 0; j < times.size(); ++j) {
+      value[j] *= disturbance_regime.pr_survival(times[j]) * scal;
+    }
+    ret.push_back(seed_rain_integrate(times, value));
+  }
+  return ret;
+}
+
+// Heuristic estimate of the seed rain still to come, relative to that
+// accumulated so far, used to end the run early
+// (Control::schedule_end_tol).  At time t a cohort introduced at t_i
+// produces seeds at rate f_i(t) P(t) / P(t_i) (the rate of
+// Cohort::fecundity), where P is the patch survival.  If rates per
+// surviving patch did not increase after t, the rest of its
+// contribution to the seed rain would be at most its current
+// contribution rate times
+//   int_t^T P(s) ds / P(t)
+// (T being the end of the schedule).  Cohorts not yet introduced are
+// estimated in the same way, using the largest current rate over the
+// interval (t, T].  Nothing guarantees that rates do not rise again
+// (or that later cohorts do no better), so this is not a bound.  To
+// guard against transient dips (e.g., during canopy closure), the
+// estimate is only used once the seed production rate of every
+// species has declined over Control::schedule_end_declines
+// successive introductions.
+template <typename T>
+bool SCM<T>::remaining_seed_rain_small() {
+  const double tol = parameters.control.schedule_end_tol;
+  if (tol <= 0.0) {
+    return false;
+  }
+  const Disturbance& disturbance_regime = patch.disturbance_regime();
+  const double t = time(), t_max = cohort_schedule.get_max_time();
+  const double pr_survival = disturbance_regime.pr_survival(t);
+  if (!(pr_survival > 0.0)) {
+    return true;
+  }
+  const double tail =
+    disturbance_regime.pr_survival_integral(t, t_max) / pr_survival;
+  const double p0 = disturbance_regime.density(0.0);
+
+  bool ret = true;
+  for (size_t i = 0; i < patch.size(); ++i) {
+    const std::vector<double> times = introduction_times(i);
+    if (times.size() < 2) {
+      ret = false;
+      continue;
+    }
+    std::vector<double> rate = patch.at(i).seeds_dt();
+    const double scal = parameters.strategies[i].S_D * parameters.seed_rain[i];
+    double rate_new = 0.0;
+    for (size_t j = 0; j < rate.size(); ++j) {
+      const double pr_survival_birth = disturbance_regime.pr_survival(times[j]);
+      rate_new = std::max(rate_new, rate[j] * pr_survival_birth);
+      rate[j] *= p0 * pr_survival_birth * scal;
+    }
+    const double rate_tot = seed_rain_integrate(times, rate);
+    const double estimate =
+      (rate_tot + p0 * scal * rate_new * (t_max - t)) * tail;
+
+    if (rate_tot < seed_rain_rate_last[i]) {
+      ++seed_rain_rate_declines[i];
+    } else {
+      seed_rain_rate_declines[i] = 0;
+    }
+    seed_rain_rate_last[i] = rate_tot;
+    const bool past_peak = seed_rain_rate_declines[i] >=
+      parameters.control.schedule_end_declines;
+    ret = ret && past_peak &&
+      estimate <= tol * seed_rain_integrate(times, seed_rain_cohort(i));
+  }
+  return ret;
+}
+
 template <typename T>
 double SCM<T>::seed_rain_total() const {
   double tot = 0.0;
@@ -245,9 +663,40 @@ double SCM<T>::seed_rain_total() const {
   return tot;
 }
 
+// Integration over introduction times, and the contribution of each
+// introduction to that, by the rule selected in Control.
+template <typename T>
+double SCM<T>::seed_rain_integrate(const std::vector<double>& times,
+                                   const std::vector<double>& seeds) const {
+  if (parameters.control.cohort_integration_cubic) {
+    return util::integrate_local_cubic(times, seeds);
+  }
+  return util::trapezium(times, seeds);
+}
+
+template <typename T>
+std::vector<double>
+SCM<T>::seed_rain_integration_error(const std::vector<double>& times,
+                                    const std::vector<double>& seeds,
+                                    double scal) const {
+  if (parameters.control.cohort_integration_cubic) {
+    return util::local_error_integration_cubic(times, seeds, scal);
+  }
+  return util::local_error_integration(times, seeds, scal);
+}
+
+// Introduction times of the cohorts present: all of the scheduled
+// times once the run is complete, unless it ended early.
+template <typename T>
+std::vector<double> SCM<T>::introduction_times(size_t species_index) const {
+  std::vector<double> times = cohort_schedule.times(species_index);
+  times.resize(std::min(times.size(), patch.at(species_index).size()));
+  return times;
+}
+
 template <typename T>
 std::vector<double> SCM<T>::seed_rain_cohort(size_t species_index) const {
-  const std::vector<double> times = cohort_schedule.times(species_index);
+  const std::vector<double> times = introduction_times(species_index);
   const Disturbance& disturbance_regime = patch.disturbance_regime();
   const double S_D = parameters.strategies[species_index].S_D;
   const double scal = S_D * parameters.seed_rain[species_index];
@@ -7,6 +7,7 @@
 #include <plant/environment.h>
 #include <plant/ode_interface.h>
 #include <plant/cohort.h>
+#include <plant/plant_plus.h>
 
 namespace plant {
 
@@ -23,12 +24,19 @@ public:
 
   size_t size() const;
   void clear();
+  void reserve(size_t n);
   void add_seed();
+  void add_seed(const Environment& environment);
+  void compute_seed_rates(const Environment& environment);
 
   double height_max() const;
   double area_leaf_above(double height) const;
   void compute_vars_phys(const Environment& environment);
   std::vector<double> seeds() const;
+  std::vector<double> seeds_dt() const;
+  std::vector<double>
+  integrate_internals(const std::vector<PlantPlus_internals_member>& members,
+                      const Environment& environment) const;
 
   // * ODE interface
   // NOTE: We are a time-independent model here so no need to pass
@@ -40,6 +48,7 @@ public:
   ode::iterator       ode_rates(ode::iterator it) const;
 
   // * R interface
+  void r_compute_vars_phys(const Environment& environment);
   std::vector<double> r_heights() const;
   void r_set_heights(std::vector<double> heights);
   const cohort_type& r_seed() const {return seed;}
@@ -47,6 +56,13 @@ public:
   const cohort_type& r_cohort_at(util::index idx) const {
     return cohorts[idx.check_bounds(size())];
   }
+  // Growth rate gradient of a cohort from its neighbours, or NA if
+  // it would fall back on perturbing its height (needs rates).
+  double r_growth_rate_gradient_neighbours(util::index idx) const {
+    const size_t i = idx.check_bounds(size());
+    return growth_rate_gradient_use_neighbours(i) ?
+      growth_rate_gradient_neighbours(i) : NA_REAL;
+  }
 
   // These are used to determine the degree of cohort refinement.
   std::vector<double> r_area_leafs() const;
@@ -56,9 +72,18 @@ public:
   std::vector<double> r_log_densities() const;
 
 private:
-  const Control& control() const {return strategy->get_control();}
+  const Control& control() const {return strategy->control;}
+  double area_leaf_above_cubic(double height) const;
+  std::vector<double> assimilation_tol_scale() const;
+  bool growth_rate_gradient_use_neighbours(size_t i) const;
+  double growth_rate_gradient_neighbours(size_t i) const;
+  void internals_density(const cohort_type& cohort,
+                         const std::vector<PlantPlus_internals_member>& members,
+                         const Environment& environment,
+                         std::vector<double>& ret) const;
   strategy_type_ptr strategy;
   cohort_type seed;
+  bool seed_rates_stale;
   std::vector<cohort_type> cohorts;
 
   typedef typename std::vector<cohort_type>::iterator cohorts_iterator;
@@ -68,7 +93,8 @@ private:
 template <typename T>
 Species<T>::Species(strategy_type s)
   : strategy(make_strategy_ptr(s)),
-    seed(strategy) {
+    seed(strategy),
+    seed_rates_stale(true) {
 }
 
 template <typename T>
@@ -81,12 +107,45 @@ void Species<T>::clear() {
   cohorts.clear();
   // Reset the seed to a blank seed, too.
   seed = cohort_type(strategy);
+  seed_rates_stale = true;
 }
 
+// Cohorts hold a pointer to the species' strategy, so reallocating
+// the cohort vector is relatively expensive; if the number of
+// cohorts that will be introduced is known, reserve space up front.
+template <typename T>
+void Species<T>::reserve(size_t n) {
+  cohorts.reserve(n);
+}
+
+// Note that this adds the seed as last computed by compute_vars_phys,
+// which only computes its initial state and not its rates (unless
+// compute_seed_rates has been called since); these will be computed
+// on the next call to compute_vars_phys.  Use the version below that
+// takes an Environment to get the full initial conditions.
 template <typename T>
 void Species<T>::add_seed() {
   cohorts.push_back(seed);
-  // TODO: Should the seed be recomputed here?
+}
+
+// The rates of the boundary seed are only needed when it is
+// introduced as a cohort, so they are computed lazily here, at most
+// once per call to compute_vars_phys.  They are computed against a
+// blank seed so that they do not depend on how many times the
+// boundary condition has been updated since the last introduction.
+template <typename T>
+void Species<T>::add_seed(const Environment& environment) {
+  compute_seed_rates(environment);
+  add_seed();
+}
+
+template <typename T>
+void Species<T>::compute_seed_rates(const Environment& environment) {
+  if (seed_rates_stale) {
+    seed = cohort_type(strategy);
+    seed.compute_initial_conditions(environment);
+    seed_rates_stale = false;
+  }
 }
 
 // If a species contains no individuals, we return the height of a
@@ -128,6 +187,9 @@ double Species<T>::area_leaf_above(double height) const {
   if (size() == 0 || height_max() < height) {
     return 0.0;
   }
+  if (control().cohort_integration_cubic) {
+    return area_leaf_above_cubic(height);
+  }
   double tot = 0.0;
   cohorts_const_iterator it = cohorts.begin();
   double h1 = it->height(), f_h1 = it->area_leaf_above(height);
@@ -154,14 +216,142 @@ double Species<T>::area_leaf_above(double height) const {
   return tot / 2;
 }
 
+// As above, but integrating by local cubic interpolation (see
+// util::LocalCubicIntegral).  Each interval's integral depends on
+// the points either side of it, so to give the same answer as
+// integrating over every cohort (and so keep this continuous in
+// 'height', which the light environment interpolation relies on),
+// the early exit has to wait until three cohorts with no leaf area
+// above 'height' have been included.  Points are added from the top
+// down, so the integral comes out negative.  The interpolating cubic
+// can dip below zero near the top of the canopy, which is truncated.
+template <typename T>
+double Species<T>::area_leaf_above_cubic(double height) const {
+  util::LocalCubicIntegral tot;
+  size_t n_below = 0;
+  for (const auto& c : cohorts) {
+    const double h = c.height(), f_h = c.area_leaf_above(height);
+    if (!util::is_finite(f_h)) {
+      util::stop("Detected non-finite contribution");
+    }
+    tot.add(h, f_h);
+    if (h < height && ++n_below == 3) {
+      break;
+    }
+  }
+  if (n_below < 3) {
+    tot.add(seed.height(), seed.area_leaf_above(height));
+  }
+  return std::max(-tot.value(), 0.0);
+}
+
 // NOTE: We should probably prefer to rescale when this is called
 // through the ode stepper.
+//
+// NOTE: Only the initial state of the boundary seed is computed here
+// (it is needed for the tail of the trapezium in area_leaf_above);
+// computing its rates requires the growth rate gradient, which is
+// deferred until the seed is actually introduced (see add_seed).
 template <typename T>
 void Species<T>::compute_vars_phys(const Environment& environment) {
-  for (auto& c : cohorts) {
-    c.compute_vars_phys(environment);
+  const size_t n = size();
+  std::vector<double> tol_scale(n, 1.0);
+  if (control().plant_assimilation_tol_weight_max > 0) {
+    tol_scale = assimilation_tol_scale();
+  }
+  std::vector<bool> neighbours(n, false);
+  for (size_t i = 0; i < n; ++i) {
+    neighbours[i] = growth_rate_gradient_use_neighbours(i);
+    cohorts[i].compute_vars_phys(environment, tol_scale[i], !neighbours[i]);
+  }
+  for (size_t i = 0; i < n; ++i) {
+    if (neighbours[i]) {
+      cohorts[i].set_growth_rate_gradient(growth_rate_gradient_neighbours(i));
+    }
+  }
+  seed.compute_initial_density(environment);
+  seed_rates_stale = true;
+}
+
+// With a positive cohort_gradient_neighbour_gap, the growth rate
+// gradient of a cohort is estimated from the heights and growth rates
+// of the cohorts either side of it, rather than by perturbing its
+// height, which saves one or more evaluations of its physiology.
+// This needs a neighbour on each side, no further away than the gap
+// (relative to the cohort's height); the tallest and shortest
+// cohorts, and any in sparse parts of the distribution, fall back on
+// perturbation.  Heights are part of the state, so which cohorts use
+// neighbours is known before any rates are computed.
+template <typename T>
+bool Species<T>::growth_rate_gradient_use_neighbours(size_t i) const {
+  const double gap = control().cohort_gradient_neighbour_gap;
+  if (gap <= 0 || i == 0 || i + 1 >= size()) {
+    return false;
+  }
+  const double h = cohorts[i].height();
+  const double d_above = cohorts[i - 1].height() - h;
+  const double d_below = h - cohorts[i + 1].height();
+  return d_above > 0 && d_below > 0 && std::max(d_above, d_below) <= gap * h;
+}
+
+// Three point finite difference on the non-uniform grid of cohort
+// heights, which is second order in the spacing.
+template <typename T>
+double Species<T>::growth_rate_gradient_neighbours(size_t i) const {
+  const double h0 = cohorts[i + 1].height(), g0 = cohorts[i + 1].plant.height_dt();
+  const double h1 = cohorts[i].height(),     g1 = cohorts[i].plant.height_dt();
+  const double h2 = cohorts[i - 1].height(), g2 = cohorts[i - 1].plant.height_dt();
+  const double d1 = h1 - h0, d2 = h2 - h1;
+  return (- d2 / (d1 * (d1 + d2)) * g0
+          + (d2 - d1) / (d1 * d2) * g1
+          + d1 / (d2 * (d1 + d2)) * g2);
+}
+
+// Scaling of the assimilation tolerance for each cohort, by its share
+// of the species.  The share s_i is the larger of the cohort's share
+// of leaf area (density times leaf area) and of the seeds produced so
+// far (seeds_survival_weighted), both of which are part of the state,
+// so the rates remain a function of the state alone.
+//
+// Scaling the tolerance by sum(s) / (n s_i) leaves the share-weighted
+// error sum(s_i tol_i) at exactly what a uniform tolerance gives, so
+// the overall error budget is unchanged: negligible cohorts get a
+// loose tolerance (usually met by the first Gauss-Kronrod rule) and
+// the dominant few a tighter one.  Capping the scale at
+// plant_assimilation_tol_weight_max only reduces the error further.
+template <typename T>
+std::vector<double> Species<T>::assimilation_tol_scale() const {
+  const size_t n = size();
+  const double scale_max = control().plant_assimilation_tol_weight_max;
+  std::vector<double> area(n), seeds(n);
+  double area_tot = 0.0, seeds_tot = 0.0;
+  for (size_t i = 0; i < n; ++i) {
+    const double a = cohorts[i].area_leaf(), s = cohorts[i].fecundity();
+    area[i]  = R_FINITE(a) ? a : 0.0;
+    seeds[i] = R_FINITE(s) ? s : 0.0;
+    area_tot  += area[i];
+    seeds_tot += seeds[i];
+  }
+
+  std::vector<double> share(n, 0.0);
+  double share_tot = 0.0;
+  for (size_t i = 0; i < n; ++i) {
+    if (area_tot > 0) {
+      share[i] = area[i] / area_tot;
+    }
+    if (seeds_tot > 0) {
+      share[i] = std::max(share[i], seeds[i] / seeds_tot);
+    }
+    share_tot += share[i];
+  }
+
+  std::vector<double> ret(n, scale_max);
+  for (size_t i = 0; i < n; ++i) {
+    if (share[i] > 0) {
+      ret[i] = std::min(scale_max, share_tot / (n * share[i]));
+    }
   }
-  seed.compute_initial_conditions(environment);
+  return ret;
 }
 
 template <typename T>
@@ -174,6 +364,72 @@ std::vector<double> Species<T>::seeds() const {
   return ret;
 }
 
+template <typename T>
+std::vector<double> Species<T>::seeds_dt() const {
+  std::vector<double> ret;
+  ret.reserve(size());
+  for (auto& c : cohorts) {
+    ret.push_back(c.fecundity_dt());
+  }
+  return ret;
+}
+
+// Totals (per unit area) of PlantPlus variables over the size
+// distribution.  As with area_leaf_above, this integrates density
+// times the variable with respect to height by the trapezium rule,
+// down to the boundary seed.  Every cohort needs its full physiology
+// computing, so this is far more expensive than the core model.
+template <typename T>
+std::vector<double>
+Species<T>::integrate_internals(const std::vector<PlantPlus_internals_member>& members,
+                                const Environment& environment) const {
+  std::vector<double> tot(members.size(), 0.0);
+  if (size() == 0) {
+    return tot;
+  }
+  std::vector<double> f_h0(members.size()), f_h1(members.size());
+  double h1 = cohorts.front().height();
+  internals_density(cohorts.front(), members, environment, f_h1);
+  auto add = [&] (const cohort_type& c) {
+    const double h0 = c.height();
+    internals_density(c, members, environment, f_h0);
+    for (size_t i = 0; i < tot.size(); ++i) {
+      tot[i] += (h1 - h0) * (f_h1[i] + f_h0[i]);
+    }
+    h1 = h0;
+    f_h1.swap(f_h0);
+  };
+  for (cohorts_const_iterator it = cohorts.begin() + 1;
+       it != cohorts.end(); ++it) {
+    add(*it);
+  }
+  add(seed);
+  for (auto& x : tot) {
+    x /= 2;
+  }
+  return tot;
+}
+
+// Shares the species' strategy rather than going through the
+// PlantPlus(Plant) constructor, which copies it.
+template <typename T>
+void Species<T>::internals_density(const cohort_type& cohort,
+                                   const std::vector<PlantPlus_internals_member>& members,
+                                   const Environment& environment,
+                                   std::vector<double>& ret) const {
+  PlantPlus<T> p(strategy);
+  std::vector<double> state(p.ode_size());
+  cohort.plant.ode_state(state.begin());
+  p.set_ode_state(state.begin());
+  p.compute_vars_phys(environment);
+  p.compute_vars_growth();
+  const PlantPlus_internals vars = p.r_internals();
+  const double density = cohort.get_density();
+  for (size_t i = 0; i < members.size(); ++i) {
+    ret[i] = density * (vars.*members[i]);
+  }
+}
+
 template <typename T>
 size_t Species<T>::ode_size() const {
   return size() * cohort_type::ode_size();
@@ -195,6 +451,15 @@ ode::iterator Species<T>::ode_rates(ode::iterator it) const {
 }
 
 
+// From R the boundary seed is computed in full, as it is visible
+// through 'seed' and can be added with the add_seed() that takes no
+// Environment.
+template <typename T>
+void Species<T>::r_compute_vars_phys(const Environment& environment) {
+  compute_vars_phys(environment);
+  compute_seed_rates(environment);
+}
+
 template <typename T>
 std::vector<double> Species<T>::r_heights() const {
   std::vector<double> ret;
@@ -230,6 +495,10 @@ std::vector<double> Species<T>::r_area_leafs() const {
 
 template <typename T>
 std::vector<double> Species<T>::r_area_leafs_error(double scal) const {
+  if (control().cohort_integration_cubic) {
+    return util::local_error_integration_cubic(r_heights(), r_area_leafs(),
+                                               scal);
+  }
   return util::local_error_integration(r_heights(), r_area_leafs(), scal);
 }
 
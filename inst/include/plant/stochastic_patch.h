@@ -75,6 +75,8 @@ public:
   void r_compute_light_environment() {compute_light_environment();}
   void r_compute_vars_phys() {compute_vars_phys();}
 private:
+  double canopy_extinction(double height) const;
+  double light_environment_target(double height) const;
   void compute_light_environment();
   void rescale_light_environment();
   void compute_vars_phys();
@@ -131,15 +133,25 @@ double StochasticPatch<T>::area_leaf_above(double height) const {
 
 template <typename T>
 double StochasticPatch<T>::canopy_openness(double height) const {
-  return exp(-parameters.k_I * area_leaf_above(height) /
-             parameters.patch_area);
+  return exp(-canopy_extinction(height));
+}
+
+template <typename T>
+double StochasticPatch<T>::canopy_extinction(double height) const {
+  return parameters.k_I * area_leaf_above(height) / parameters.patch_area;
+}
+
+template <typename T>
+double StochasticPatch<T>::light_environment_target(double height) const {
+  return parameters.control.environment_light_leaf_area ?
+    canopy_extinction(height) : canopy_openness(height);
 }
 
 
 template <typename T>
 void StochasticPatch<T>::compute_light_environment() {
   if (parameters.n_residents() > 0 & height_max() > 0.0) {
-    auto f = [&] (double x) -> double {return canopy_openness(x);};
+    auto f = [&] (double x) -> double {return light_environment_target(x);};
     environment.compute_light_environment(f, height_max());
   } else {
     environment.clear_light_environment();
@@ -149,7 +161,7 @@ void StochasticPatch<T>::compute_light_environment() {
 template <typename T>
 void StochasticPatch<T>::rescale_light_environment() {
   if (parameters.n_residents() > 0 & height_max() > 0.0) {
-    auto f = [&] (double x) -> double {return canopy_openness(x);};
+    auto f = [&] (double x) -> double {return light_environment_target(x);};
     environment.rescale_light_environment(f, height_max());
   }
 }
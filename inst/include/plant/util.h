@@ -167,11 +167,121 @@ std::vector<double> trapezium_vector(const ContainerX& x,
   return ret;
 }
 
+// Integral over [x1, x2] of the polynomial interpolating (x1, y1),
+// (x2, y2), and the neighbouring points (x0, y0) and (x3, y3) where
+// available (has_0, has_3).  With both neighbours this is a cubic,
+// with one a quadratic, and with neither the trapezium rule.  Points
+// may be in increasing or decreasing order; the integral is signed
+// accordingly.
+inline double integrate_interval_local(bool has_0, double x0, double y0,
+                                       double x1, double y1,
+                                       double x2, double y2,
+                                       bool has_3, double x3, double y3) {
+  const double h = x2 - x1, f12 = (y2 - y1) / h;
+  double tot = h * (y1 + y2) / 2;
+  if (has_0 && has_3) {
+    const double d = x1 - x0;
+    const double f012 = (f12 - (y1 - y0) / d) / (x2 - x0);
+    const double f123 = ((y3 - y2) / (x3 - x2) - f12) / (x3 - x1);
+    const double f0123 = (f123 - f012) / (x3 - x0);
+    tot -= h * h * h * (f012 / 6 + (h / 12 + d / 6) * f0123);
+  } else if (has_0) {
+    tot -= h * h * h / 6 * (f12 - (y1 - y0) / (x1 - x0)) / (x2 - x0);
+  } else if (has_3) {
+    tot -= h * h * h / 6 * ((y3 - y2) / (x3 - x2) - f12) / (x3 - x1);
+  }
+  return tot;
+}
+
+// Integration by local cubic interpolation: each interval is
+// integrated with the cubic through its end points and their
+// neighbours (quadratics for the first and last intervals).  This is
+// fourth order on nonuniform grids, where the trapezium rule is
+// second order.  Points are added one at a time (in either
+// direction) so that integrals over cohorts need no intermediate
+// storage.  Repeated points are dropped.
+class LocalCubicIntegral {
+public:
+  LocalCubicIntegral()
+    : n(0), tot(0.0), x0(0), x1(0), x2(0), x3(0), y0(0), y1(0), y2(0), y3(0),
+      f1_0(0), f1_1(0), f1_2(0), f2_0(0), f2_1(0) {}
+  void add(double x_new, double y_new) {
+    if (n > 0 && x_new == x3) {
+      return;
+    }
+    x0 = x1; x1 = x2; x2 = x3; x3 = x_new;
+    y0 = y1; y1 = y2; y2 = y3; y3 = y_new;
+    // Divided differences; f1_i = f[x_i, x_{i+1}] and
+    // f2_i = f[x_i, x_{i+1}, x_{i+2}]
+    f1_0 = f1_1; f1_1 = f1_2;
+    f2_0 = f2_1;
+    if (n > 0) {
+      f1_2 = (y3 - y2) / (x3 - x2);
+    }
+    if (n > 1) {
+      f2_1 = (f1_2 - f1_1) / (x3 - x1);
+    }
+    ++n;
+    const double h = x2 - x1;
+    if (n == 3) {
+      tot += h * (y1 + y2) / 2 - h * h * h / 6 * f2_1;
+    } else if (n > 3) {
+      const double d = x1 - x0, f3 = (f2_1 - f2_0) / (x3 - x0);
+      tot += h * (y1 + y2) / 2 - h * h * h * (f2_0 / 6 + (h / 12 + d / 6) * f3);
+    }
+  }
+  // Integral from the first to the last point added.
+  double value() const {
+    const double h = x3 - x2;
+    if (n < 2) {
+      return 0.0;
+    } else if (n == 2) {
+      return h * (y2 + y3) / 2;
+    }
+    return tot + h * (y2 + y3) / 2 - h * h * h / 6 * f2_1;
+  }
+private:
+  size_t n;
+  double tot;
+  // The last four points, newest last, and their divided differences
+  double x0, x1, x2, x3, y0, y1, y2, y3, f1_0, f1_1, f1_2, f2_0, f2_1;
+};
+
+template <typename ContainerX, typename ContainerY>
+double integrate_local_cubic(const ContainerX& x, const ContainerY& y) {
+  util::check_length(y.size(), x.size());
+  if (x.size() < 2) {
+    util::stop("Need at least two points for integration");
+  }
+  LocalCubicIntegral integral;
+  typename ContainerX::const_iterator xi = x.begin();
+  typename ContainerY::const_iterator yi = y.begin();
+  while (xi != x.end()) {
+    integral.add(*xi++, *yi++);
+  }
+  return integral.value();
+}
+
 template <typename T>
 T clamp(T x, T min_val, T max_val) {
   return std::max(std::min(x, max_val), min_val);
 }
 
+// x^n for nonnegative integer n, by repeated squaring.  This is much
+// cheaper than std::pow for the small powers we need (e.g., the
+// canopy shape parameter eta) and accurate to a few ulp.
+inline double ipow(double x, size_t n) {
+  double ret = 1.0;
+  while (n > 0) {
+    if (n & 1) {
+      ret *= x;
+    }
+    x *= x;
+    n >>= 1;
+  }
+  return ret;
+}
+
 bool is_function(SEXP x);
 
 // The basic idea here is that we consider the three points
@@ -181,6 +291,11 @@ bool is_function(SEXP x);
 std::vector<double> local_error_integration(const std::vector<double>& x,
                                             const std::vector<double>& y,
                                             double scal);
+// As above, but the contribution of each point to the integral by
+// local cubic interpolation (integrate_local_cubic).
+std::vector<double> local_error_integration_cubic(const std::vector<double>& x,
+                                                  const std::vector<double>& y,
+                                                  double scal);
 
 SEXP get_from_package(const std::string& name);
 
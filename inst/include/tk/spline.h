@@ -83,9 +83,13 @@ private:
    // interpolation parameters
    // f(x) = a*(x-x_i)^3 + b*(x-x_i)^2 + c*(x-x_i) + y_i
    std::vector<double> m_a,m_b,m_c,m_d;
+   static double pchip_end(double h0, double h1, double delta0, double delta1);
 public:
    void set_points(const std::vector<double>& x,
                    const std::vector<double>& y, bool cubic_spline=true);
+   // monotone piecewise cubic Hermite interpolation (as in pchip)
+   void set_points_monotone(const std::vector<double>& x,
+                            const std::vector<double>& y);
    double operator() (double x) const;
 };
 
@@ -19,6 +19,24 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// FF16_approximate_annual_assimilation
+Rcpp::NumericMatrix FF16_approximate_annual_assimilation(std::vector<double> narea, double narea_0, double B_lf1, double B_lf2, double B_lf3, double B_lf5, double k_I, double latitude);
+RcppExport SEXP _plant_FF16_approximate_annual_assimilation(SEXP nareaSEXP, SEXP narea_0SEXP, SEXP B_lf1SEXP, SEXP B_lf2SEXP, SEXP B_lf3SEXP, SEXP B_lf5SEXP, SEXP k_ISEXP, SEXP latitudeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<double> >::type narea(nareaSEXP);
+    Rcpp::traits::input_parameter< double >::type narea_0(narea_0SEXP);
+    Rcpp::traits::input_parameter< double >::type B_lf1(B_lf1SEXP);
+    Rcpp::traits::input_parameter< double >::type B_lf2(B_lf2SEXP);
+    Rcpp::traits::input_parameter< double >::type B_lf3(B_lf3SEXP);
+    Rcpp::traits::input_parameter< double >::type B_lf5(B_lf5SEXP);
+    Rcpp::traits::input_parameter< double >::type k_I(k_ISEXP);
+    Rcpp::traits::input_parameter< double >::type latitude(latitudeSEXP);
+    rcpp_result_gen = Rcpp::wrap(FF16_approximate_annual_assimilation(narea, narea_0, B_lf1, B_lf2, B_lf3, B_lf5, k_I, latitude));
+    return rcpp_result_gen;
+END_RCPP
+}
 // test_gradient_fd1
 double test_gradient_fd1(Rcpp::Function f, double x, double dx, int direction, double fx);
 RcppExport SEXP _plant_test_gradient_fd1(SEXP fSEXP, SEXP xSEXP, SEXP dxSEXP, SEXP directionSEXP, SEXP fxSEXP) {
@@ -128,6 +146,60 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// FF16_lcp_whole_plants
+std::vector<double> FF16_lcp_whole_plants(std::vector<plant::FF16_Strategy> strategies, double height);
+RcppExport SEXP _plant_FF16_lcp_whole_plants(SEXP strategiesSEXP, SEXP heightSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<plant::FF16_Strategy> >::type strategies(strategiesSEXP);
+    Rcpp::traits::input_parameter< double >::type height(heightSEXP);
+    rcpp_result_gen = Rcpp::wrap(FF16_lcp_whole_plants(strategies, height));
+    return rcpp_result_gen;
+END_RCPP
+}
+// FF16r_lcp_whole_plants
+std::vector<double> FF16r_lcp_whole_plants(std::vector<plant::FF16r_Strategy> strategies, double height);
+RcppExport SEXP _plant_FF16r_lcp_whole_plants(SEXP strategiesSEXP, SEXP heightSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<plant::FF16r_Strategy> >::type strategies(strategiesSEXP);
+    Rcpp::traits::input_parameter< double >::type height(heightSEXP);
+    rcpp_result_gen = Rcpp::wrap(FF16r_lcp_whole_plants(strategies, height));
+    return rcpp_result_gen;
+END_RCPP
+}
+// FF16_grow_plants_to_size_times
+Rcpp::NumericMatrix FF16_grow_plants_to_size_times(std::vector<plant::FF16_Strategy> strategies, std::vector<double> sizes, std::string size_name, plant::Environment env, double time_max);
+RcppExport SEXP _plant_FF16_grow_plants_to_size_times(SEXP strategiesSEXP, SEXP sizesSEXP, SEXP size_nameSEXP, SEXP envSEXP, SEXP time_maxSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<plant::FF16_Strategy> >::type strategies(strategiesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type sizes(sizesSEXP);
+    Rcpp::traits::input_parameter< std::string >::type size_name(size_nameSEXP);
+    Rcpp::traits::input_parameter< plant::Environment >::type env(envSEXP);
+    Rcpp::traits::input_parameter< double >::type time_max(time_maxSEXP);
+    rcpp_result_gen = Rcpp::wrap(FF16_grow_plants_to_size_times(strategies, sizes, size_name, env, time_max));
+    return rcpp_result_gen;
+END_RCPP
+}
+// FF16r_grow_plants_to_size_times
+Rcpp::NumericMatrix FF16r_grow_plants_to_size_times(std::vector<plant::FF16r_Strategy> strategies, std::vector<double> sizes, std::string size_name, plant::Environment env, double time_max);
+RcppExport SEXP _plant_FF16r_grow_plants_to_size_times(SEXP strategiesSEXP, SEXP sizesSEXP, SEXP size_nameSEXP, SEXP envSEXP, SEXP time_maxSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<plant::FF16r_Strategy> >::type strategies(strategiesSEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type sizes(sizesSEXP);
+    Rcpp::traits::input_parameter< std::string >::type size_name(size_nameSEXP);
+    Rcpp::traits::input_parameter< plant::Environment >::type env(envSEXP);
+    Rcpp::traits::input_parameter< double >::type time_max(time_maxSEXP);
+    rcpp_result_gen = Rcpp::wrap(FF16r_grow_plants_to_size_times(strategies, sizes, size_name, env, time_max));
+    return rcpp_result_gen;
+END_RCPP
+}
 // Lorenz__ctor
 plant::ode::test::Lorenz Lorenz__ctor(double sigma, double R, double b);
 RcppExport SEXP _plant_Lorenz__ctor(SEXP sigmaSEXP, SEXP RSEXP, SEXP bSEXP) {
@@ -340,6 +412,17 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// OdeRunner___Lorenz__object__set
+void OdeRunner___Lorenz__object__set(plant::RcppR6::RcppR6<plant::ode::Runner<plant::ode::test::Lorenz> > obj_, plant::ode::test::Lorenz value);
+RcppExport SEXP _plant_OdeRunner___Lorenz__object__set(SEXP obj_SEXP, SEXP valueSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::ode::Runner<plant::ode::test::Lorenz> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< plant::ode::test::Lorenz >::type value(valueSEXP);
+    OdeRunner___Lorenz__object__set(obj_, value);
+    return R_NilValue;
+END_RCPP
+}
 // OdeRunner___OdeR__ctor
 plant::ode::Runner<plant::ode::test::OdeR> OdeRunner___OdeR__ctor(plant::ode::test::OdeR obj, plant::ode::OdeControl control);
 RcppExport SEXP _plant_OdeRunner___OdeR__ctor(SEXP objSEXP, SEXP controlSEXP) {
@@ -461,6 +544,17 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// OdeRunner___OdeR__object__set
+void OdeRunner___OdeR__object__set(plant::RcppR6::RcppR6<plant::ode::Runner<plant::ode::test::OdeR> > obj_, plant::ode::test::OdeR value);
+RcppExport SEXP _plant_OdeRunner___OdeR__object__set(SEXP obj_SEXP, SEXP valueSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::ode::Runner<plant::ode::test::OdeR> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< plant::ode::test::OdeR >::type value(valueSEXP);
+    OdeRunner___OdeR__object__set(obj_, value);
+    return R_NilValue;
+END_RCPP
+}
 // OdeRunner___FF16__ctor
 plant::ode::Runner<plant::tools::PlantRunner<plant::FF16_Strategy> > OdeRunner___FF16__ctor(plant::tools::PlantRunner<plant::FF16_Strategy> obj, plant::ode::OdeControl control);
 RcppExport SEXP _plant_OdeRunner___FF16__ctor(SEXP objSEXP, SEXP controlSEXP) {
@@ -582,6 +676,17 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// OdeRunner___FF16__object__set
+void OdeRunner___FF16__object__set(plant::RcppR6::RcppR6<plant::ode::Runner<plant::tools::PlantRunner<plant::FF16_Strategy> > > obj_, plant::tools::PlantRunner<plant::FF16_Strategy> value);
+RcppExport SEXP _plant_OdeRunner___FF16__object__set(SEXP obj_SEXP, SEXP valueSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::ode::Runner<plant::tools::PlantRunner<plant::FF16_Strategy> > > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< plant::tools::PlantRunner<plant::FF16_Strategy> >::type value(valueSEXP);
+    OdeRunner___FF16__object__set(obj_, value);
+    return R_NilValue;
+END_RCPP
+}
 // OdeRunner___FF16r__ctor
 plant::ode::Runner<plant::tools::PlantRunner<plant::FF16r_Strategy> > OdeRunner___FF16r__ctor(plant::tools::PlantRunner<plant::FF16r_Strategy> obj, plant::ode::OdeControl control);
 RcppExport SEXP _plant_OdeRunner___FF16r__ctor(SEXP objSEXP, SEXP controlSEXP) {
@@ -703,6 +808,17 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// OdeRunner___FF16r__object__set
+void OdeRunner___FF16r__object__set(plant::RcppR6::RcppR6<plant::ode::Runner<plant::tools::PlantRunner<plant::FF16r_Strategy> > > obj_, plant::tools::PlantRunner<plant::FF16r_Strategy> value);
+RcppExport SEXP _plant_OdeRunner___FF16r__object__set(SEXP obj_SEXP, SEXP valueSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::ode::Runner<plant::tools::PlantRunner<plant::FF16r_Strategy> > > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< plant::tools::PlantRunner<plant::FF16r_Strategy> >::type value(valueSEXP);
+    OdeRunner___FF16r__object__set(obj_, value);
+    return R_NilValue;
+END_RCPP
+}
 // CohortScheduleEvent__ctor
 plant::CohortScheduleEvent CohortScheduleEvent__ctor(double introduction, plant::util::index species_index);
 RcppExport SEXP _plant_CohortScheduleEvent__ctor(SEXP introductionSEXP, SEXP species_indexSEXP) {
@@ -1410,6 +1526,28 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// Interpolator__monotone__get
+bool Interpolator__monotone__get(plant::RcppR6::RcppR6<plant::interpolator::Interpolator> obj_);
+RcppExport SEXP _plant_Interpolator__monotone__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::interpolator::Interpolator> >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(Interpolator__monotone__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Interpolator__monotone__set
+void Interpolator__monotone__set(plant::RcppR6::RcppR6<plant::interpolator::Interpolator> obj_, bool value);
+RcppExport SEXP _plant_Interpolator__monotone__set(SEXP obj_SEXP, SEXP valueSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::interpolator::Interpolator> >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< bool >::type value(valueSEXP);
+    Interpolator__monotone__set(obj_, value);
+    return R_NilValue;
+END_RCPP
+}
 // Environment__ctor
 plant::Environment Environment__ctor(double disturbance_mean_interval, std::vector<double> seed_rain, plant::Control control);
 RcppExport SEXP _plant_Environment__ctor(SEXP disturbance_mean_intervalSEXP, SEXP seed_rainSEXP, SEXP controlSEXP) {
@@ -1556,6 +1694,17 @@ BEGIN_RCPP
     return R_NilValue;
 END_RCPP
 }
+// Environment__light_environment_openness__get
+SEXP Environment__light_environment_openness__get(plant::RcppR6::RcppR6<plant::Environment> obj_);
+RcppExport SEXP _plant_Environment__light_environment_openness__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::Environment> >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(Environment__light_environment_openness__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
 // Plant_internals__ctor
 SEXP Plant_internals__ctor();
 RcppExport SEXP _plant_Plant_internals__ctor() {
@@ -1600,6 +1749,19 @@ BEGIN_RCPP
     return R_NilValue;
 END_RCPP
 }
+// Plant___FF16__height_dt_given_height
+double Plant___FF16__height_dt_given_height(plant::RcppR6::RcppR6<plant::Plant<plant::FF16_Strategy> > obj_, double height, const plant::Environment& environment);
+RcppExport SEXP _plant_Plant___FF16__height_dt_given_height(SEXP obj_SEXP, SEXP heightSEXP, SEXP environmentSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::Plant<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< double >::type height(heightSEXP);
+    Rcpp::traits::input_parameter< const plant::Environment& >::type environment(environmentSEXP);
+    rcpp_result_gen = Rcpp::wrap(Plant___FF16__height_dt_given_height(obj_, height, environment));
+    return rcpp_result_gen;
+END_RCPP
+}
 // Plant___FF16__germination_probability
 double Plant___FF16__germination_probability(plant::RcppR6::RcppR6<plant::Plant<plant::FF16_Strategy> > obj_, const plant::Environment& environment);
 RcppExport SEXP _plant_Plant___FF16__germination_probability(SEXP obj_SEXP, SEXP environmentSEXP) {
@@ -1821,6 +1983,19 @@ BEGIN_RCPP
     return R_NilValue;
 END_RCPP
 }
+// Plant___FF16r__height_dt_given_height
+double Plant___FF16r__height_dt_given_height(plant::RcppR6::RcppR6<plant::Plant<plant::FF16r_Strategy> > obj_, double height, const plant::Environment& environment);
+RcppExport SEXP _plant_Plant___FF16r__height_dt_given_height(SEXP obj_SEXP, SEXP heightSEXP, SEXP environmentSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::Plant<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< double >::type height(heightSEXP);
+    Rcpp::traits::input_parameter< const plant::Environment& >::type environment(environmentSEXP);
+    rcpp_result_gen = Rcpp::wrap(Plant___FF16r__height_dt_given_height(obj_, height, environment));
+    return rcpp_result_gen;
+END_RCPP
+}
 // Plant___FF16r__germination_probability
 double Plant___FF16r__germination_probability(plant::RcppR6::RcppR6<plant::Plant<plant::FF16r_Strategy> > obj_, const plant::Environment& environment);
 RcppExport SEXP _plant_Plant___FF16r__germination_probability(SEXP obj_SEXP, SEXP environmentSEXP) {
@@ -3088,6 +3263,29 @@ BEGIN_RCPP
     return R_NilValue;
 END_RCPP
 }
+// Species___FF16__assimilation_tol_scale
+std::vector<double> Species___FF16__assimilation_tol_scale(plant::RcppR6::RcppR6<plant::Species<plant::FF16_Strategy> > obj_);
+RcppExport SEXP _plant_Species___FF16__assimilation_tol_scale(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::Species<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(Species___FF16__assimilation_tol_scale(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Species___FF16__growth_rate_gradient_neighbours
+double Species___FF16__growth_rate_gradient_neighbours(plant::RcppR6::RcppR6<plant::Species<plant::FF16_Strategy> > obj_, plant::util::index index);
+RcppExport SEXP _plant_Species___FF16__growth_rate_gradient_neighbours(SEXP obj_SEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::Species<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< plant::util::index >::type index(indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(Species___FF16__growth_rate_gradient_neighbours(obj_, index));
+    return rcpp_result_gen;
+END_RCPP
+}
 // Species___FF16__cohort_at
 plant::Cohort<plant::FF16_Strategy> Species___FF16__cohort_at(plant::RcppR6::RcppR6<plant::Species<plant::FF16_Strategy> > obj_, plant::util::index index);
 RcppExport SEXP _plant_Species___FF16__cohort_at(SEXP obj_SEXP, SEXP indexSEXP) {
@@ -3309,6 +3507,29 @@ BEGIN_RCPP
     return R_NilValue;
 END_RCPP
 }
+// Species___FF16r__assimilation_tol_scale
+std::vector<double> Species___FF16r__assimilation_tol_scale(plant::RcppR6::RcppR6<plant::Species<plant::FF16r_Strategy> > obj_);
+RcppExport SEXP _plant_Species___FF16r__assimilation_tol_scale(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::Species<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(Species___FF16r__assimilation_tol_scale(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Species___FF16r__growth_rate_gradient_neighbours
+double Species___FF16r__growth_rate_gradient_neighbours(plant::RcppR6::RcppR6<plant::Species<plant::FF16r_Strategy> > obj_, plant::util::index index);
+RcppExport SEXP _plant_Species___FF16r__growth_rate_gradient_neighbours(SEXP obj_SEXP, SEXP indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::Species<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< plant::util::index >::type index(indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(Species___FF16r__growth_rate_gradient_neighbours(obj_, index));
+    return rcpp_result_gen;
+END_RCPP
+}
 // Species___FF16r__cohort_at
 plant::Cohort<plant::FF16r_Strategy> Species___FF16r__cohort_at(plant::RcppR6::RcppR6<plant::Species<plant::FF16r_Strategy> > obj_, plant::util::index index);
 RcppExport SEXP _plant_Species___FF16r__cohort_at(SEXP obj_SEXP, SEXP indexSEXP) {
@@ -4015,6 +4236,99 @@ BEGIN_RCPP
     return R_NilValue;
 END_RCPP
 }
+// SCM___FF16__set_seed_rain
+void SCM___FF16__set_seed_rain(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_, std::vector<double> seed_rain);
+RcppExport SEXP _plant_SCM___FF16__set_seed_rain(SEXP obj_SEXP, SEXP seed_rainSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type seed_rain(seed_rainSEXP);
+    SCM___FF16__set_seed_rain(obj_, seed_rain);
+    return R_NilValue;
+END_RCPP
+}
+// SCM___FF16__set_integrate_internals
+void SCM___FF16__set_integrate_internals(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_, std::vector<std::string> names);
+RcppExport SEXP _plant_SCM___FF16__set_integrate_internals(SEXP obj_SEXP, SEXP namesSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< std::vector<std::string> >::type names(namesSEXP);
+    SCM___FF16__set_integrate_internals(obj_, names);
+    return R_NilValue;
+END_RCPP
+}
+// SCM___FF16__integrate_internals_total
+std::vector<std::vector<double> > SCM___FF16__integrate_internals_total(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_, plant::util::index species_index);
+RcppExport SEXP _plant_SCM___FF16__integrate_internals_total(SEXP obj_SEXP, SEXP species_indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< plant::util::index >::type species_index(species_indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(SCM___FF16__integrate_internals_total(obj_, species_index));
+    return rcpp_result_gen;
+END_RCPP
+}
+// SCM___FF16__integrate_internals_cumulative
+std::vector<std::vector<double> > SCM___FF16__integrate_internals_cumulative(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_, plant::util::index species_index);
+RcppExport SEXP _plant_SCM___FF16__integrate_internals_cumulative(SEXP obj_SEXP, SEXP species_indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< plant::util::index >::type species_index(species_indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(SCM___FF16__integrate_internals_cumulative(obj_, species_index));
+    return rcpp_result_gen;
+END_RCPP
+}
+// SCM___FF16__set_record_seeds
+void SCM___FF16__set_record_seeds(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_, bool record);
+RcppExport SEXP _plant_SCM___FF16__set_record_seeds(SEXP obj_SEXP, SEXP recordSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< bool >::type record(recordSEXP);
+    SCM___FF16__set_record_seeds(obj_, record);
+    return R_NilValue;
+END_RCPP
+}
+// SCM___FF16__seed_rain_disturbance
+std::vector<std::vector<double> > SCM___FF16__seed_rain_disturbance(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_, std::vector<double> mean_interval);
+RcppExport SEXP _plant_SCM___FF16__seed_rain_disturbance(SEXP obj_SEXP, SEXP mean_intervalSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type mean_interval(mean_intervalSEXP);
+    rcpp_result_gen = Rcpp::wrap(SCM___FF16__seed_rain_disturbance(obj_, mean_interval));
+    return rcpp_result_gen;
+END_RCPP
+}
+// SCM___FF16__seed_rain_survival
+std::vector<double> SCM___FF16__seed_rain_survival(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_, std::vector<double> pr_survival, double mean_interval);
+RcppExport SEXP _plant_SCM___FF16__seed_rain_survival(SEXP obj_SEXP, SEXP pr_survivalSEXP, SEXP mean_intervalSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type pr_survival(pr_survivalSEXP);
+    Rcpp::traits::input_parameter< double >::type mean_interval(mean_intervalSEXP);
+    rcpp_result_gen = Rcpp::wrap(SCM___FF16__seed_rain_survival(obj_, pr_survival, mean_interval));
+    return rcpp_result_gen;
+END_RCPP
+}
+// SCM___FF16__run_error
+Rcpp::List SCM___FF16__run_error(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_);
+RcppExport SEXP _plant_SCM___FF16__run_error(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(SCM___FF16__run_error(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
 // SCM___FF16__complete__get
 bool SCM___FF16__complete__get(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_);
 RcppExport SEXP _plant_SCM___FF16__complete__get(SEXP obj_SEXP) {
@@ -4147,6 +4461,28 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// SCM___FF16__integrate_internals_time__get
+std::vector<double> SCM___FF16__integrate_internals_time__get(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_);
+RcppExport SEXP _plant_SCM___FF16__integrate_internals_time__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(SCM___FF16__integrate_internals_time__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
+// SCM___FF16__seed_rain_record_time__get
+std::vector<double> SCM___FF16__seed_rain_record_time__get(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_);
+RcppExport SEXP _plant_SCM___FF16__seed_rain_record_time__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(SCM___FF16__seed_rain_record_time__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
 // SCM___FF16r__ctor
 plant::SCM<plant::FF16r_Strategy> SCM___FF16r__ctor(plant::Parameters<plant::FF16r_Strategy> parameters);
 RcppExport SEXP _plant_SCM___FF16r__ctor(SEXP parametersSEXP) {
@@ -4236,6 +4572,99 @@ BEGIN_RCPP
     return R_NilValue;
 END_RCPP
 }
+// SCM___FF16r__set_seed_rain
+void SCM___FF16r__set_seed_rain(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_, std::vector<double> seed_rain);
+RcppExport SEXP _plant_SCM___FF16r__set_seed_rain(SEXP obj_SEXP, SEXP seed_rainSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type seed_rain(seed_rainSEXP);
+    SCM___FF16r__set_seed_rain(obj_, seed_rain);
+    return R_NilValue;
+END_RCPP
+}
+// SCM___FF16r__set_integrate_internals
+void SCM___FF16r__set_integrate_internals(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_, std::vector<std::string> names);
+RcppExport SEXP _plant_SCM___FF16r__set_integrate_internals(SEXP obj_SEXP, SEXP namesSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< std::vector<std::string> >::type names(namesSEXP);
+    SCM___FF16r__set_integrate_internals(obj_, names);
+    return R_NilValue;
+END_RCPP
+}
+// SCM___FF16r__integrate_internals_total
+std::vector<std::vector<double> > SCM___FF16r__integrate_internals_total(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_, plant::util::index species_index);
+RcppExport SEXP _plant_SCM___FF16r__integrate_internals_total(SEXP obj_SEXP, SEXP species_indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< plant::util::index >::type species_index(species_indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(SCM___FF16r__integrate_internals_total(obj_, species_index));
+    return rcpp_result_gen;
+END_RCPP
+}
+// SCM___FF16r__integrate_internals_cumulative
+std::vector<std::vector<double> > SCM___FF16r__integrate_internals_cumulative(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_, plant::util::index species_index);
+RcppExport SEXP _plant_SCM___FF16r__integrate_internals_cumulative(SEXP obj_SEXP, SEXP species_indexSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< plant::util::index >::type species_index(species_indexSEXP);
+    rcpp_result_gen = Rcpp::wrap(SCM___FF16r__integrate_internals_cumulative(obj_, species_index));
+    return rcpp_result_gen;
+END_RCPP
+}
+// SCM___FF16r__set_record_seeds
+void SCM___FF16r__set_record_seeds(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_, bool record);
+RcppExport SEXP _plant_SCM___FF16r__set_record_seeds(SEXP obj_SEXP, SEXP recordSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< bool >::type record(recordSEXP);
+    SCM___FF16r__set_record_seeds(obj_, record);
+    return R_NilValue;
+END_RCPP
+}
+// SCM___FF16r__seed_rain_disturbance
+std::vector<std::vector<double> > SCM___FF16r__seed_rain_disturbance(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_, std::vector<double> mean_interval);
+RcppExport SEXP _plant_SCM___FF16r__seed_rain_disturbance(SEXP obj_SEXP, SEXP mean_intervalSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type mean_interval(mean_intervalSEXP);
+    rcpp_result_gen = Rcpp::wrap(SCM___FF16r__seed_rain_disturbance(obj_, mean_interval));
+    return rcpp_result_gen;
+END_RCPP
+}
+// SCM___FF16r__seed_rain_survival
+std::vector<double> SCM___FF16r__seed_rain_survival(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_, std::vector<double> pr_survival, double mean_interval);
+RcppExport SEXP _plant_SCM___FF16r__seed_rain_survival(SEXP obj_SEXP, SEXP pr_survivalSEXP, SEXP mean_intervalSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< std::vector<double> >::type pr_survival(pr_survivalSEXP);
+    Rcpp::traits::input_parameter< double >::type mean_interval(mean_intervalSEXP);
+    rcpp_result_gen = Rcpp::wrap(SCM___FF16r__seed_rain_survival(obj_, pr_survival, mean_interval));
+    return rcpp_result_gen;
+END_RCPP
+}
+// SCM___FF16r__run_error
+Rcpp::List SCM___FF16r__run_error(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_);
+RcppExport SEXP _plant_SCM___FF16r__run_error(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(SCM___FF16r__run_error(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
 // SCM___FF16r__complete__get
 bool SCM___FF16r__complete__get(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_);
 RcppExport SEXP _plant_SCM___FF16r__complete__get(SEXP obj_SEXP) {
@@ -4368,6 +4797,28 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// SCM___FF16r__integrate_internals_time__get
+std::vector<double> SCM___FF16r__integrate_internals_time__get(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_);
+RcppExport SEXP _plant_SCM___FF16r__integrate_internals_time__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(SCM___FF16r__integrate_internals_time__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
+// SCM___FF16r__seed_rain_record_time__get
+std::vector<double> SCM___FF16r__seed_rain_record_time__get(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_);
+RcppExport SEXP _plant_SCM___FF16r__seed_rain_record_time__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(SCM___FF16r__seed_rain_record_time__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
 // StochasticSpecies___FF16__ctor
 plant::StochasticSpecies<plant::FF16_Strategy> StochasticSpecies___FF16__ctor(plant::FF16_Strategy strategy);
 RcppExport SEXP _plant_StochasticSpecies___FF16__ctor(SEXP strategySEXP) {
@@ -5586,6 +6037,244 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// MeshSCM___FF16__ctor
+plant::MeshSCM<plant::FF16_Strategy> MeshSCM___FF16__ctor(plant::Parameters<plant::FF16_Strategy> parameters);
+RcppExport SEXP _plant_MeshSCM___FF16__ctor(SEXP parametersSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::Parameters<plant::FF16_Strategy> >::type parameters(parametersSEXP);
+    rcpp_result_gen = Rcpp::wrap(MeshSCM___FF16__ctor(parameters));
+    return rcpp_result_gen;
+END_RCPP
+}
+// MeshSCM___FF16__run
+void MeshSCM___FF16__run(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_);
+RcppExport SEXP _plant_MeshSCM___FF16__run(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    MeshSCM___FF16__run(obj_);
+    return R_NilValue;
+END_RCPP
+}
+// MeshSCM___FF16__advance
+void MeshSCM___FF16__advance(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_, double time);
+RcppExport SEXP _plant_MeshSCM___FF16__advance(SEXP obj_SEXP, SEXP timeSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< double >::type time(timeSEXP);
+    MeshSCM___FF16__advance(obj_, time);
+    return R_NilValue;
+END_RCPP
+}
+// MeshSCM___FF16__reset
+void MeshSCM___FF16__reset(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_);
+RcppExport SEXP _plant_MeshSCM___FF16__reset(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    MeshSCM___FF16__reset(obj_);
+    return R_NilValue;
+END_RCPP
+}
+// MeshSCM___FF16__complete__get
+bool MeshSCM___FF16__complete__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_);
+RcppExport SEXP _plant_MeshSCM___FF16__complete__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(MeshSCM___FF16__complete__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
+// MeshSCM___FF16__time__get
+double MeshSCM___FF16__time__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_);
+RcppExport SEXP _plant_MeshSCM___FF16__time__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(MeshSCM___FF16__time__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
+// MeshSCM___FF16__seed_rains__get
+std::vector<double> MeshSCM___FF16__seed_rains__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_);
+RcppExport SEXP _plant_MeshSCM___FF16__seed_rains__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(MeshSCM___FF16__seed_rains__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
+// MeshSCM___FF16__parameters__get
+plant::Parameters<plant::FF16_Strategy> MeshSCM___FF16__parameters__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_);
+RcppExport SEXP _plant_MeshSCM___FF16__parameters__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(MeshSCM___FF16__parameters__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
+// MeshSCM___FF16__ode_times__get
+std::vector<double> MeshSCM___FF16__ode_times__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_);
+RcppExport SEXP _plant_MeshSCM___FF16__ode_times__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(MeshSCM___FF16__ode_times__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
+// MeshSCM___FF16__heights__get
+std::vector<std::vector<double> > MeshSCM___FF16__heights__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_);
+RcppExport SEXP _plant_MeshSCM___FF16__heights__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(MeshSCM___FF16__heights__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
+// MeshSCM___FF16__densities__get
+std::vector<std::vector<double> > MeshSCM___FF16__densities__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_);
+RcppExport SEXP _plant_MeshSCM___FF16__densities__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(MeshSCM___FF16__densities__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
+// MeshSCM___FF16r__ctor
+plant::MeshSCM<plant::FF16r_Strategy> MeshSCM___FF16r__ctor(plant::Parameters<plant::FF16r_Strategy> parameters);
+RcppExport SEXP _plant_MeshSCM___FF16r__ctor(SEXP parametersSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::Parameters<plant::FF16r_Strategy> >::type parameters(parametersSEXP);
+    rcpp_result_gen = Rcpp::wrap(MeshSCM___FF16r__ctor(parameters));
+    return rcpp_result_gen;
+END_RCPP
+}
+// MeshSCM___FF16r__run
+void MeshSCM___FF16r__run(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_);
+RcppExport SEXP _plant_MeshSCM___FF16r__run(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    MeshSCM___FF16r__run(obj_);
+    return R_NilValue;
+END_RCPP
+}
+// MeshSCM___FF16r__advance
+void MeshSCM___FF16r__advance(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_, double time);
+RcppExport SEXP _plant_MeshSCM___FF16r__advance(SEXP obj_SEXP, SEXP timeSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    Rcpp::traits::input_parameter< double >::type time(timeSEXP);
+    MeshSCM___FF16r__advance(obj_, time);
+    return R_NilValue;
+END_RCPP
+}
+// MeshSCM___FF16r__reset
+void MeshSCM___FF16r__reset(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_);
+RcppExport SEXP _plant_MeshSCM___FF16r__reset(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    MeshSCM___FF16r__reset(obj_);
+    return R_NilValue;
+END_RCPP
+}
+// MeshSCM___FF16r__complete__get
+bool MeshSCM___FF16r__complete__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_);
+RcppExport SEXP _plant_MeshSCM___FF16r__complete__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(MeshSCM___FF16r__complete__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
+// MeshSCM___FF16r__time__get
+double MeshSCM___FF16r__time__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_);
+RcppExport SEXP _plant_MeshSCM___FF16r__time__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(MeshSCM___FF16r__time__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
+// MeshSCM___FF16r__seed_rains__get
+std::vector<double> MeshSCM___FF16r__seed_rains__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_);
+RcppExport SEXP _plant_MeshSCM___FF16r__seed_rains__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(MeshSCM___FF16r__seed_rains__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
+// MeshSCM___FF16r__parameters__get
+plant::Parameters<plant::FF16r_Strategy> MeshSCM___FF16r__parameters__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_);
+RcppExport SEXP _plant_MeshSCM___FF16r__parameters__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(MeshSCM___FF16r__parameters__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
+// MeshSCM___FF16r__ode_times__get
+std::vector<double> MeshSCM___FF16r__ode_times__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_);
+RcppExport SEXP _plant_MeshSCM___FF16r__ode_times__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(MeshSCM___FF16r__ode_times__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
+// MeshSCM___FF16r__heights__get
+std::vector<std::vector<double> > MeshSCM___FF16r__heights__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_);
+RcppExport SEXP _plant_MeshSCM___FF16r__heights__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(MeshSCM___FF16r__heights__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
+// MeshSCM___FF16r__densities__get
+std::vector<std::vector<double> > MeshSCM___FF16r__densities__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_);
+RcppExport SEXP _plant_MeshSCM___FF16r__densities__get(SEXP obj_SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > >::type obj_(obj_SEXP);
+    rcpp_result_gen = Rcpp::wrap(MeshSCM___FF16r__densities__get(obj_));
+    return rcpp_result_gen;
+END_RCPP
+}
 // cohort_schedule_max_time_default__Parameters___FF16
 double cohort_schedule_max_time_default__Parameters___FF16(const plant::Parameters<plant::FF16_Strategy>& p);
 RcppExport SEXP _plant_cohort_schedule_max_time_default__Parameters___FF16(SEXP pSEXP) {
@@ -5724,9 +6413,47 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// integrate_local_cubic
+double integrate_local_cubic(const std::vector<double>& x, const std::vector<double>& y);
+RcppExport SEXP _plant_integrate_local_cubic(SEXP xSEXP, SEXP ySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const std::vector<double>& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const std::vector<double>& >::type y(ySEXP);
+    rcpp_result_gen = Rcpp::wrap(integrate_local_cubic(x, y));
+    return rcpp_result_gen;
+END_RCPP
+}
+// local_error_integration_cubic
+std::vector<double> local_error_integration_cubic(const std::vector<double>& x, const std::vector<double>& y, double scal);
+RcppExport SEXP _plant_local_error_integration_cubic(SEXP xSEXP, SEXP ySEXP, SEXP scalSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const std::vector<double>& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const std::vector<double>& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< double >::type scal(scalSEXP);
+    rcpp_result_gen = Rcpp::wrap(local_error_integration_cubic(x, y, scal));
+    return rcpp_result_gen;
+END_RCPP
+}
+// test_ipow
+double test_ipow(double x, size_t n);
+RcppExport SEXP _plant_test_ipow(SEXP xSEXP, SEXP nSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< double >::type x(xSEXP);
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    rcpp_result_gen = Rcpp::wrap(test_ipow(x, n));
+    return rcpp_result_gen;
+END_RCPP
+}
 
 static const R_CallMethodDef CallEntries[] = {
     {"_plant_test_adaptive_interpolator", (DL_FUNC) &_plant_test_adaptive_interpolator, 3},
+    {"_plant_FF16_approximate_annual_assimilation", (DL_FUNC) &_plant_FF16_approximate_annual_assimilation, 8},
     {"_plant_test_gradient_fd1", (DL_FUNC) &_plant_test_gradient_fd1, 5},
     {"_plant_test_gradient_richardson", (DL_FUNC) &_plant_test_gradient_richardson, 4},
     {"_plant_FF16_plant_to_plant_plus", (DL_FUNC) &_plant_FF16_plant_to_plant_plus, 2},
@@ -5736,6 +6463,10 @@ static const R_CallMethodDef CallEntries[] = {
     {"_plant_FF16r_oderunner_plant_internals", (DL_FUNC) &_plant_FF16r_oderunner_plant_internals, 1},
     {"_plant_FF16_lcp_whole_plant", (DL_FUNC) &_plant_FF16_lcp_whole_plant, 1},
     {"_plant_FF16r_lcp_whole_plant", (DL_FUNC) &_plant_FF16r_lcp_whole_plant, 1},
+    {"_plant_FF16_lcp_whole_plants", (DL_FUNC) &_plant_FF16_lcp_whole_plants, 2},
+    {"_plant_FF16r_lcp_whole_plants", (DL_FUNC) &_plant_FF16r_lcp_whole_plants, 2},
+    {"_plant_FF16_grow_plants_to_size_times", (DL_FUNC) &_plant_FF16_grow_plants_to_size_times, 5},
+    {"_plant_FF16r_grow_plants_to_size_times", (DL_FUNC) &_plant_FF16r_grow_plants_to_size_times, 5},
     {"_plant_Lorenz__ctor", (DL_FUNC) &_plant_Lorenz__ctor, 3},
     {"_plant_Lorenz__ode_size__get", (DL_FUNC) &_plant_Lorenz__ode_size__get, 1},
     {"_plant_Lorenz__ode_state__get", (DL_FUNC) &_plant_Lorenz__ode_state__get, 1},
@@ -5755,6 +6486,7 @@ static const R_CallMethodDef CallEntries[] = {
     {"_plant_OdeRunner___Lorenz__state__get", (DL_FUNC) &_plant_OdeRunner___Lorenz__state__get, 1},
     {"_plant_OdeRunner___Lorenz__times__get", (DL_FUNC) &_plant_OdeRunner___Lorenz__times__get, 1},
     {"_plant_OdeRunner___Lorenz__object__get", (DL_FUNC) &_plant_OdeRunner___Lorenz__object__get, 1},
+    {"_plant_OdeRunner___Lorenz__object__set", (DL_FUNC) &_plant_OdeRunner___Lorenz__object__set, 2},
     {"_plant_OdeRunner___OdeR__ctor", (DL_FUNC) &_plant_OdeRunner___OdeR__ctor, 2},
     {"_plant_OdeRunner___OdeR__advance", (DL_FUNC) &_plant_OdeRunner___OdeR__advance, 2},
     {"_plant_OdeRunner___OdeR__advance_fixed", (DL_FUNC) &_plant_OdeRunner___OdeR__advance_fixed, 2},
@@ -5766,6 +6498,7 @@ static const R_CallMethodDef CallEntries[] = {
     {"_plant_OdeRunner___OdeR__state__get", (DL_FUNC) &_plant_OdeRunner___OdeR__state__get, 1},
     {"_plant_OdeRunner___OdeR__times__get", (DL_FUNC) &_plant_OdeRunner___OdeR__times__get, 1},
     {"_plant_OdeRunner___OdeR__object__get", (DL_FUNC) &_plant_OdeRunner___OdeR__object__get, 1},
+    {"_plant_OdeRunner___OdeR__object__set", (DL_FUNC) &_plant_OdeRunner___OdeR__object__set, 2},
     {"_plant_OdeRunner___FF16__ctor", (DL_FUNC) &_plant_OdeRunner___FF16__ctor, 2},
     {"_plant_OdeRunner___FF16__advance", (DL_FUNC) &_plant_OdeRunner___FF16__advance, 2},
     {"_plant_OdeRunner___FF16__advance_fixed", (DL_FUNC) &_plant_OdeRunner___FF16__advance_fixed, 2},
@@ -5777,6 +6510,7 @@ static const R_CallMethodDef CallEntries[] = {
     {"_plant_OdeRunner___FF16__state__get", (DL_FUNC) &_plant_OdeRunner___FF16__state__get, 1},
     {"_plant_OdeRunner___FF16__times__get", (DL_FUNC) &_plant_OdeRunner___FF16__times__get, 1},
     {"_plant_OdeRunner___FF16__object__get", (DL_FUNC) &_plant_OdeRunner___FF16__object__get, 1},
+    {"_plant_OdeRunner___FF16__object__set", (DL_FUNC) &_plant_OdeRunner___FF16__object__set, 2},
     {"_plant_OdeRunner___FF16r__ctor", (DL_FUNC) &_plant_OdeRunner___FF16r__ctor, 2},
     {"_plant_OdeRunner___FF16r__advance", (DL_FUNC) &_plant_OdeRunner___FF16r__advance, 2},
     {"_plant_OdeRunner___FF16r__advance_fixed", (DL_FUNC) &_plant_OdeRunner___FF16r__advance_fixed, 2},
@@ -5788,6 +6522,7 @@ static const R_CallMethodDef CallEntries[] = {
     {"_plant_OdeRunner___FF16r__state__get", (DL_FUNC) &_plant_OdeRunner___FF16r__state__get, 1},
     {"_plant_OdeRunner___FF16r__times__get", (DL_FUNC) &_plant_OdeRunner___FF16r__times__get, 1},
     {"_plant_OdeRunner___FF16r__object__get", (DL_FUNC) &_plant_OdeRunner___FF16r__object__get, 1},
+    {"_plant_OdeRunner___FF16r__object__set", (DL_FUNC) &_plant_OdeRunner___FF16r__object__set, 2},
     {"_plant_CohortScheduleEvent__ctor", (DL_FUNC) &_plant_CohortScheduleEvent__ctor, 2},
     {"_plant_CohortScheduleEvent__species_index__get", (DL_FUNC) &_plant_CohortScheduleEvent__species_index__get, 1},
     {"_plant_CohortScheduleEvent__species_index__set", (DL_FUNC) &_plant_CohortScheduleEvent__species_index__set, 2},
@@ -5850,6 +6585,8 @@ static const R_CallMethodDef CallEntries[] = {
     {"_plant_Interpolator__size__get", (DL_FUNC) &_plant_Interpolator__size__get, 1},
     {"_plant_Interpolator__min__get", (DL_FUNC) &_plant_Interpolator__min__get, 1},
     {"_plant_Interpolator__max__get", (DL_FUNC) &_plant_Interpolator__max__get, 1},
+    {"_plant_Interpolator__monotone__get", (DL_FUNC) &_plant_Interpolator__monotone__get, 1},
+    {"_plant_Interpolator__monotone__set", (DL_FUNC) &_plant_Interpolator__monotone__set, 2},
     {"_plant_Environment__ctor", (DL_FUNC) &_plant_Environment__ctor, 3},
     {"_plant_Environment__canopy_openness", (DL_FUNC) &_plant_Environment__canopy_openness, 2},
     {"_plant_Environment__patch_survival_conditional", (DL_FUNC) &_plant_Environment__patch_survival_conditional, 2},
@@ -5863,10 +6600,12 @@ static const R_CallMethodDef CallEntries[] = {
     {"_plant_Environment__time__set", (DL_FUNC) &_plant_Environment__time__set, 2},
     {"_plant_Environment__light_environment__get", (DL_FUNC) &_plant_Environment__light_environment__get, 1},
     {"_plant_Environment__light_environment__set", (DL_FUNC) &_plant_Environment__light_environment__set, 2},
+    {"_plant_Environment__light_environment_openness__get", (DL_FUNC) &_plant_Environment__light_environment_openness__get, 1},
     {"_plant_Plant_internals__ctor", (DL_FUNC) &_plant_Plant_internals__ctor, 0},
     {"_plant_Plant___FF16__ctor", (DL_FUNC) &_plant_Plant___FF16__ctor, 1},
     {"_plant_Plant___FF16__area_leaf_above", (DL_FUNC) &_plant_Plant___FF16__area_leaf_above, 2},
     {"_plant_Plant___FF16__compute_vars_phys", (DL_FUNC) &_plant_Plant___FF16__compute_vars_phys, 2},
+    {"_plant_Plant___FF16__height_dt_given_height", (DL_FUNC) &_plant_Plant___FF16__height_dt_given_height, 3},
     {"_plant_Plant___FF16__germination_probability", (DL_FUNC) &_plant_Plant___FF16__germination_probability, 2},
     {"_plant_Plant___FF16__reset_mortality", (DL_FUNC) &_plant_Plant___FF16__reset_mortality, 1},
     {"_plant_Plant___FF16__height__get", (DL_FUNC) &_plant_Plant___FF16__height__get, 1},
@@ -5887,6 +6626,7 @@ static const R_CallMethodDef CallEntries[] = {
     {"_plant_Plant___FF16r__ctor", (DL_FUNC) &_plant_Plant___FF16r__ctor, 1},
     {"_plant_Plant___FF16r__area_leaf_above", (DL_FUNC) &_plant_Plant___FF16r__area_leaf_above, 2},
     {"_plant_Plant___FF16r__compute_vars_phys", (DL_FUNC) &_plant_Plant___FF16r__compute_vars_phys, 2},
+    {"_plant_Plant___FF16r__height_dt_given_height", (DL_FUNC) &_plant_Plant___FF16r__height_dt_given_height, 3},
     {"_plant_Plant___FF16r__germination_probability", (DL_FUNC) &_plant_Plant___FF16r__germination_probability, 2},
     {"_plant_Plant___FF16r__reset_mortality", (DL_FUNC) &_plant_Plant___FF16r__reset_mortality, 1},
     {"_plant_Plant___FF16r__height__get", (DL_FUNC) &_plant_Plant___FF16r__height__get, 1},
@@ -6002,6 +6742,8 @@ static const R_CallMethodDef CallEntries[] = {
     {"_plant_Species___FF16__compute_vars_phys", (DL_FUNC) &_plant_Species___FF16__compute_vars_phys, 2},
     {"_plant_Species___FF16__area_leaf_above", (DL_FUNC) &_plant_Species___FF16__area_leaf_above, 2},
     {"_plant_Species___FF16__add_seed", (DL_FUNC) &_plant_Species___FF16__add_seed, 1},
+    {"_plant_Species___FF16__assimilation_tol_scale", (DL_FUNC) &_plant_Species___FF16__assimilation_tol_scale, 1},
+    {"_plant_Species___FF16__growth_rate_gradient_neighbours", (DL_FUNC) &_plant_Species___FF16__growth_rate_gradient_neighbours, 2},
     {"_plant_Species___FF16__cohort_at", (DL_FUNC) &_plant_Species___FF16__cohort_at, 2},
     {"_plant_Species___FF16__area_leafs_error", (DL_FUNC) &_plant_Species___FF16__area_leafs_error, 2},
     {"_plant_Species___FF16__size__get", (DL_FUNC) &_plant_Species___FF16__size__get, 1},
@@ -6022,6 +6764,8 @@ static const R_CallMethodDef CallEntries[] = {
     {"_plant_Species___FF16r__compute_vars_phys", (DL_FUNC) &_plant_Species___FF16r__compute_vars_phys, 2},
     {"_plant_Species___FF16r__area_leaf_above", (DL_FUNC) &_plant_Species___FF16r__area_leaf_above, 2},
     {"_plant_Species___FF16r__add_seed", (DL_FUNC) &_plant_Species___FF16r__add_seed, 1},
+    {"_plant_Species___FF16r__assimilation_tol_scale", (DL_FUNC) &_plant_Species___FF16r__assimilation_tol_scale, 1},
+    {"_plant_Species___FF16r__growth_rate_gradient_neighbours", (DL_FUNC) &_plant_Species___FF16r__growth_rate_gradient_neighbours, 2},
     {"_plant_Species___FF16r__cohort_at", (DL_FUNC) &_plant_Species___FF16r__cohort_at, 2},
     {"_plant_Species___FF16r__area_leafs_error", (DL_FUNC) &_plant_Species___FF16r__area_leafs_error, 2},
     {"_plant_Species___FF16r__size__get", (DL_FUNC) &_plant_Species___FF16r__size__get, 1},
@@ -6085,6 +6829,14 @@ static const R_CallMethodDef CallEntries[] = {
     {"_plant_SCM___FF16__seed_rain_cohort", (DL_FUNC) &_plant_SCM___FF16__seed_rain_cohort, 2},
     {"_plant_SCM___FF16__area_leaf_error", (DL_FUNC) &_plant_SCM___FF16__area_leaf_error, 2},
     {"_plant_SCM___FF16__set_cohort_schedule_times", (DL_FUNC) &_plant_SCM___FF16__set_cohort_schedule_times, 2},
+    {"_plant_SCM___FF16__set_seed_rain", (DL_FUNC) &_plant_SCM___FF16__set_seed_rain, 2},
+    {"_plant_SCM___FF16__set_integrate_internals", (DL_FUNC) &_plant_SCM___FF16__set_integrate_internals, 2},
+    {"_plant_SCM___FF16__integrate_internals_total", (DL_FUNC) &_plant_SCM___FF16__integrate_internals_total, 2},
+    {"_plant_SCM___FF16__integrate_internals_cumulative", (DL_FUNC) &_plant_SCM___FF16__integrate_internals_cumulative, 2},
+    {"_plant_SCM___FF16__set_record_seeds", (DL_FUNC) &_plant_SCM___FF16__set_record_seeds, 2},
+    {"_plant_SCM___FF16__seed_rain_disturbance", (DL_FUNC) &_plant_SCM___FF16__seed_rain_disturbance, 2},
+    {"_plant_SCM___FF16__seed_rain_survival", (DL_FUNC) &_plant_SCM___FF16__seed_rain_survival, 3},
+    {"_plant_SCM___FF16__run_error", (DL_FUNC) &_plant_SCM___FF16__run_error, 1},
     {"_plant_SCM___FF16__complete__get", (DL_FUNC) &_plant_SCM___FF16__complete__get, 1},
     {"_plant_SCM___FF16__time__get", (DL_FUNC) &_plant_SCM___FF16__time__get, 1},
     {"_plant_SCM___FF16__seed_rains__get", (DL_FUNC) &_plant_SCM___FF16__seed_rains__get, 1},
@@ -6097,6 +6849,8 @@ static const R_CallMethodDef CallEntries[] = {
     {"_plant_SCM___FF16__use_ode_times__get", (DL_FUNC) &_plant_SCM___FF16__use_ode_times__get, 1},
     {"_plant_SCM___FF16__use_ode_times__set", (DL_FUNC) &_plant_SCM___FF16__use_ode_times__set, 2},
     {"_plant_SCM___FF16__seed_rain_error__get", (DL_FUNC) &_plant_SCM___FF16__seed_rain_error__get, 1},
+    {"_plant_SCM___FF16__integrate_internals_time__get", (DL_FUNC) &_plant_SCM___FF16__integrate_internals_time__get, 1},
+    {"_plant_SCM___FF16__seed_rain_record_time__get", (DL_FUNC) &_plant_SCM___FF16__seed_rain_record_time__get, 1},
     {"_plant_SCM___FF16r__ctor", (DL_FUNC) &_plant_SCM___FF16r__ctor, 1},
     {"_plant_SCM___FF16r__run", (DL_FUNC) &_plant_SCM___FF16r__run, 1},
     {"_plant_SCM___FF16r__run_next", (DL_FUNC) &_plant_SCM___FF16r__run_next, 1},
@@ -6105,6 +6859,14 @@ static const R_CallMethodDef CallEntries[] = {
     {"_plant_SCM___FF16r__seed_rain_cohort", (DL_FUNC) &_plant_SCM___FF16r__seed_rain_cohort, 2},
     {"_plant_SCM___FF16r__area_leaf_error", (DL_FUNC) &_plant_SCM___FF16r__area_leaf_error, 2},
     {"_plant_SCM___FF16r__set_cohort_schedule_times", (DL_FUNC) &_plant_SCM___FF16r__set_cohort_schedule_times, 2},
+    {"_plant_SCM___FF16r__set_seed_rain", (DL_FUNC) &_plant_SCM___FF16r__set_seed_rain, 2},
+    {"_plant_SCM___FF16r__set_integrate_internals", (DL_FUNC) &_plant_SCM___FF16r__set_integrate_internals, 2},
+    {"_plant_SCM___FF16r__integrate_internals_total", (DL_FUNC) &_plant_SCM___FF16r__integrate_internals_total, 2},
+    {"_plant_SCM___FF16r__integrate_internals_cumulative", (DL_FUNC) &_plant_SCM___FF16r__integrate_internals_cumulative, 2},
+    {"_plant_SCM___FF16r__set_record_seeds", (DL_FUNC) &_plant_SCM___FF16r__set_record_seeds, 2},
+    {"_plant_SCM___FF16r__seed_rain_disturbance", (DL_FUNC) &_plant_SCM___FF16r__seed_rain_disturbance, 2},
+    {"_plant_SCM___FF16r__seed_rain_survival", (DL_FUNC) &_plant_SCM___FF16r__seed_rain_survival, 3},
+    {"_plant_SCM___FF16r__run_error", (DL_FUNC) &_plant_SCM___FF16r__run_error, 1},
     {"_plant_SCM___FF16r__complete__get", (DL_FUNC) &_plant_SCM___FF16r__complete__get, 1},
     {"_plant_SCM___FF16r__time__get", (DL_FUNC) &_plant_SCM___FF16r__time__get, 1},
     {"_plant_SCM___FF16r__seed_rains__get", (DL_FUNC) &_plant_SCM___FF16r__seed_rains__get, 1},
@@ -6117,6 +6879,8 @@ static const R_CallMethodDef CallEntries[] = {
     {"_plant_SCM___FF16r__use_ode_times__get", (DL_FUNC) &_plant_SCM___FF16r__use_ode_times__get, 1},
     {"_plant_SCM___FF16r__use_ode_times__set", (DL_FUNC) &_plant_SCM___FF16r__use_ode_times__set, 2},
     {"_plant_SCM___FF16r__seed_rain_error__get", (DL_FUNC) &_plant_SCM___FF16r__seed_rain_error__get, 1},
+    {"_plant_SCM___FF16r__integrate_internals_time__get", (DL_FUNC) &_plant_SCM___FF16r__integrate_internals_time__get, 1},
+    {"_plant_SCM___FF16r__seed_rain_record_time__get", (DL_FUNC) &_plant_SCM___FF16r__seed_rain_record_time__get, 1},
     {"_plant_StochasticSpecies___FF16__ctor", (DL_FUNC) &_plant_StochasticSpecies___FF16__ctor, 1},
     {"_plant_StochasticSpecies___FF16__clear", (DL_FUNC) &_plant_StochasticSpecies___FF16__clear, 1},
     {"_plant_StochasticSpecies___FF16__compute_vars_phys", (DL_FUNC) &_plant_StochasticSpecies___FF16__compute_vars_phys, 2},
@@ -6227,6 +6991,28 @@ static const R_CallMethodDef CallEntries[] = {
     {"_plant_StochasticPatchRunner___FF16r__schedule__get", (DL_FUNC) &_plant_StochasticPatchRunner___FF16r__schedule__get, 1},
     {"_plant_StochasticPatchRunner___FF16r__schedule__set", (DL_FUNC) &_plant_StochasticPatchRunner___FF16r__schedule__set, 2},
     {"_plant_StochasticPatchRunner___FF16r__state__get", (DL_FUNC) &_plant_StochasticPatchRunner___FF16r__state__get, 1},
+    {"_plant_MeshSCM___FF16__ctor", (DL_FUNC) &_plant_MeshSCM___FF16__ctor, 1},
+    {"_plant_MeshSCM___FF16__run", (DL_FUNC) &_plant_MeshSCM___FF16__run, 1},
+    {"_plant_MeshSCM___FF16__advance", (DL_FUNC) &_plant_MeshSCM___FF16__advance, 2},
+    {"_plant_MeshSCM___FF16__reset", (DL_FUNC) &_plant_MeshSCM___FF16__reset, 1},
+    {"_plant_MeshSCM___FF16__complete__get", (DL_FUNC) &_plant_MeshSCM___FF16__complete__get, 1},
+    {"_plant_MeshSCM___FF16__time__get", (DL_FUNC) &_plant_MeshSCM___FF16__time__get, 1},
+    {"_plant_MeshSCM___FF16__seed_rains__get", (DL_FUNC) &_plant_MeshSCM___FF16__seed_rains__get, 1},
+    {"_plant_MeshSCM___FF16__parameters__get", (DL_FUNC) &_plant_MeshSCM___FF16__parameters__get, 1},
+    {"_plant_MeshSCM___FF16__ode_times__get", (DL_FUNC) &_plant_MeshSCM___FF16__ode_times__get, 1},
+    {"_plant_MeshSCM___FF16__heights__get", (DL_FUNC) &_plant_MeshSCM___FF16__heights__get, 1},
+    {"_plant_MeshSCM___FF16__densities__get", (DL_FUNC) &_plant_MeshSCM___FF16__densities__get, 1},
+    {"_plant_MeshSCM___FF16r__ctor", (DL_FUNC) &_plant_MeshSCM___FF16r__ctor, 1},
+    {"_plant_MeshSCM___FF16r__run", (DL_FUNC) &_plant_MeshSCM___FF16r__run, 1},
+    {"_plant_MeshSCM___FF16r__advance", (DL_FUNC) &_plant_MeshSCM___FF16r__advance, 2},
+    {"_plant_MeshSCM___FF16r__reset", (DL_FUNC) &_plant_MeshSCM___FF16r__reset, 1},
+    {"_plant_MeshSCM___FF16r__complete__get", (DL_FUNC) &_plant_MeshSCM___FF16r__complete__get, 1},
+    {"_plant_MeshSCM___FF16r__time__get", (DL_FUNC) &_plant_MeshSCM___FF16r__time__get, 1},
+    {"_plant_MeshSCM___FF16r__seed_rains__get", (DL_FUNC) &_plant_MeshSCM___FF16r__seed_rains__get, 1},
+    {"_plant_MeshSCM___FF16r__parameters__get", (DL_FUNC) &_plant_MeshSCM___FF16r__parameters__get, 1},
+    {"_plant_MeshSCM___FF16r__ode_times__get", (DL_FUNC) &_plant_MeshSCM___FF16r__ode_times__get, 1},
+    {"_plant_MeshSCM___FF16r__heights__get", (DL_FUNC) &_plant_MeshSCM___FF16r__heights__get, 1},
+    {"_plant_MeshSCM___FF16r__densities__get", (DL_FUNC) &_plant_MeshSCM___FF16r__densities__get, 1},
     {"_plant_cohort_schedule_max_time_default__Parameters___FF16", (DL_FUNC) &_plant_cohort_schedule_max_time_default__Parameters___FF16, 1},
     {"_plant_cohort_schedule_max_time_default__Parameters___FF16r", (DL_FUNC) &_plant_cohort_schedule_max_time_default__Parameters___FF16r, 1},
     {"_plant_cohort_schedule_default__Parameters___FF16", (DL_FUNC) &_plant_cohort_schedule_default__Parameters___FF16, 1},
@@ -6239,6 +7025,9 @@ static const R_CallMethodDef CallEntries[] = {
     {"_plant_trapezium", (DL_FUNC) &_plant_trapezium, 2},
     {"_plant_trapezium_vector", (DL_FUNC) &_plant_trapezium_vector, 2},
     {"_plant_local_error_integration", (DL_FUNC) &_plant_local_error_integration, 3},
+    {"_plant_integrate_local_cubic", (DL_FUNC) &_plant_integrate_local_cubic, 2},
+    {"_plant_local_error_integration_cubic", (DL_FUNC) &_plant_local_error_integration_cubic, 3},
+    {"_plant_test_ipow", (DL_FUNC) &_plant_test_ipow, 2},
     {NULL, NULL, 0}
 };
 
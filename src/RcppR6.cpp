@@ -86,6 +86,10 @@ std::vector<double> OdeRunner___Lorenz__times__get(plant::RcppR6::RcppR6<plant::
 plant::ode::test::Lorenz OdeRunner___Lorenz__object__get(plant::RcppR6::RcppR6<plant::ode::Runner<plant::ode::test::Lorenz> > obj_) {
   return obj_->object();
 }
+// [[Rcpp::export]]
+void OdeRunner___Lorenz__object__set(plant::RcppR6::RcppR6<plant::ode::Runner<plant::ode::test::Lorenz> > obj_, plant::ode::test::Lorenz value) {
+  obj_->set_object(value);
+}
 
 
 // [[Rcpp::export]]
@@ -135,6 +139,10 @@ std::vector<double> OdeRunner___OdeR__times__get(plant::RcppR6::RcppR6<plant::od
 plant::ode::test::OdeR OdeRunner___OdeR__object__get(plant::RcppR6::RcppR6<plant::ode::Runner<plant::ode::test::OdeR> > obj_) {
   return obj_->object();
 }
+// [[Rcpp::export]]
+void OdeRunner___OdeR__object__set(plant::RcppR6::RcppR6<plant::ode::Runner<plant::ode::test::OdeR> > obj_, plant::ode::test::OdeR value) {
+  obj_->set_object(value);
+}
 
 
 // [[Rcpp::export]]
@@ -184,6 +192,10 @@ std::vector<double> OdeRunner___FF16__times__get(plant::RcppR6::RcppR6<plant::od
 plant::tools::PlantRunner<plant::FF16_Strategy> OdeRunner___FF16__object__get(plant::RcppR6::RcppR6<plant::ode::Runner<plant::tools::PlantRunner<plant::FF16_Strategy> > > obj_) {
   return obj_->object();
 }
+// [[Rcpp::export]]
+void OdeRunner___FF16__object__set(plant::RcppR6::RcppR6<plant::ode::Runner<plant::tools::PlantRunner<plant::FF16_Strategy> > > obj_, plant::tools::PlantRunner<plant::FF16_Strategy> value) {
+  obj_->set_object(value);
+}
 
 
 // [[Rcpp::export]]
@@ -233,6 +245,10 @@ std::vector<double> OdeRunner___FF16r__times__get(plant::RcppR6::RcppR6<plant::o
 plant::tools::PlantRunner<plant::FF16r_Strategy> OdeRunner___FF16r__object__get(plant::RcppR6::RcppR6<plant::ode::Runner<plant::tools::PlantRunner<plant::FF16r_Strategy> > > obj_) {
   return obj_->object();
 }
+// [[Rcpp::export]]
+void OdeRunner___FF16r__object__set(plant::RcppR6::RcppR6<plant::ode::Runner<plant::tools::PlantRunner<plant::FF16r_Strategy> > > obj_, plant::tools::PlantRunner<plant::FF16r_Strategy> value) {
+  obj_->set_object(value);
+}
 
 
 // [[Rcpp::export]]
@@ -521,6 +537,15 @@ double Interpolator__max__get(plant::RcppR6::RcppR6<plant::interpolator::Interpo
   return obj_->max();
 }
 
+// [[Rcpp::export]]
+bool Interpolator__monotone__get(plant::RcppR6::RcppR6<plant::interpolator::Interpolator> obj_) {
+  return obj_->is_monotone();
+}
+// [[Rcpp::export]]
+void Interpolator__monotone__set(plant::RcppR6::RcppR6<plant::interpolator::Interpolator> obj_, bool value) {
+  obj_->set_monotone(value);
+}
+
 
 // [[Rcpp::export]]
 plant::Environment Environment__ctor(double disturbance_mean_interval, std::vector<double> seed_rain, plant::Control control) {
@@ -579,6 +604,11 @@ void Environment__light_environment__set(plant::RcppR6::RcppR6<plant::Environmen
   obj_->light_environment = value;
 }
 
+// [[Rcpp::export]]
+SEXP Environment__light_environment_openness__get(plant::RcppR6::RcppR6<plant::Environment> obj_) {
+  return obj_->r_light_environment_openness();
+}
+
 
 // [[Rcpp::export]]
 SEXP Plant_internals__ctor() {
@@ -599,6 +629,10 @@ void Plant___FF16__compute_vars_phys(plant::RcppR6::RcppR6<plant::Plant<plant::F
   obj_->compute_vars_phys(environment);
 }
 // [[Rcpp::export]]
+double Plant___FF16__height_dt_given_height(plant::RcppR6::RcppR6<plant::Plant<plant::FF16_Strategy> > obj_, double height, const plant::Environment& environment) {
+  return obj_->height_dt_given_height(height, environment);
+}
+// [[Rcpp::export]]
 double Plant___FF16__germination_probability(plant::RcppR6::RcppR6<plant::Plant<plant::FF16_Strategy> > obj_, const plant::Environment& environment) {
   return obj_->germination_probability(environment);
 }
@@ -691,6 +725,10 @@ void Plant___FF16r__compute_vars_phys(plant::RcppR6::RcppR6<plant::Plant<plant::
   obj_->compute_vars_phys(environment);
 }
 // [[Rcpp::export]]
+double Plant___FF16r__height_dt_given_height(plant::RcppR6::RcppR6<plant::Plant<plant::FF16r_Strategy> > obj_, double height, const plant::Environment& environment) {
+  return obj_->height_dt_given_height(height, environment);
+}
+// [[Rcpp::export]]
 double Plant___FF16r__germination_probability(plant::RcppR6::RcppR6<plant::Plant<plant::FF16r_Strategy> > obj_, const plant::Environment& environment) {
   return obj_->germination_probability(environment);
 }
@@ -1214,7 +1252,7 @@ void Species___FF16__clear(plant::RcppR6::RcppR6<plant::Species<plant::FF16_Stra
 }
 // [[Rcpp::export]]
 void Species___FF16__compute_vars_phys(plant::RcppR6::RcppR6<plant::Species<plant::FF16_Strategy> > obj_, const plant::Environment& environment) {
-  obj_->compute_vars_phys(environment);
+  obj_->r_compute_vars_phys(environment);
 }
 // [[Rcpp::export]]
 double Species___FF16__area_leaf_above(plant::RcppR6::RcppR6<plant::Species<plant::FF16_Strategy> > obj_, double height) {
@@ -1225,6 +1263,14 @@ void Species___FF16__add_seed(plant::RcppR6::RcppR6<plant::Species<plant::FF16_S
   obj_->add_seed();
 }
 // [[Rcpp::export]]
+std::vector<double> Species___FF16__assimilation_tol_scale(plant::RcppR6::RcppR6<plant::Species<plant::FF16_Strategy> > obj_) {
+  return obj_->assimilation_tol_scale();
+}
+// [[Rcpp::export]]
+double Species___FF16__growth_rate_gradient_neighbours(plant::RcppR6::RcppR6<plant::Species<plant::FF16_Strategy> > obj_, plant::util::index index) {
+  return obj_->r_growth_rate_gradient_neighbours(index);
+}
+// [[Rcpp::export]]
 plant::Cohort<plant::FF16_Strategy> Species___FF16__cohort_at(plant::RcppR6::RcppR6<plant::Species<plant::FF16_Strategy> > obj_, plant::util::index index) {
   return obj_->r_cohort_at(index);
 }
@@ -1306,7 +1352,7 @@ void Species___FF16r__clear(plant::RcppR6::RcppR6<plant::Species<plant::FF16r_St
 }
 // [[Rcpp::export]]
 void Species___FF16r__compute_vars_phys(plant::RcppR6::RcppR6<plant::Species<plant::FF16r_Strategy> > obj_, const plant::Environment& environment) {
-  obj_->compute_vars_phys(environment);
+  obj_->r_compute_vars_phys(environment);
 }
 // [[Rcpp::export]]
 double Species___FF16r__area_leaf_above(plant::RcppR6::RcppR6<plant::Species<plant::FF16r_Strategy> > obj_, double height) {
@@ -1317,6 +1363,14 @@ void Species___FF16r__add_seed(plant::RcppR6::RcppR6<plant::Species<plant::FF16r
   obj_->add_seed();
 }
 // [[Rcpp::export]]
+std::vector<double> Species___FF16r__assimilation_tol_scale(plant::RcppR6::RcppR6<plant::Species<plant::FF16r_Strategy> > obj_) {
+  return obj_->assimilation_tol_scale();
+}
+// [[Rcpp::export]]
+double Species___FF16r__growth_rate_gradient_neighbours(plant::RcppR6::RcppR6<plant::Species<plant::FF16r_Strategy> > obj_, plant::util::index index) {
+  return obj_->r_growth_rate_gradient_neighbours(index);
+}
+// [[Rcpp::export]]
 plant::Cohort<plant::FF16r_Strategy> Species___FF16r__cohort_at(plant::RcppR6::RcppR6<plant::Species<plant::FF16r_Strategy> > obj_, plant::util::index index) {
   return obj_->r_cohort_at(index);
 }
@@ -1603,6 +1657,38 @@ void SCM___FF16__set_cohort_schedule_times(plant::RcppR6::RcppR6<plant::SCM<plan
   obj_->r_set_cohort_schedule_times(times);
 }
 // [[Rcpp::export]]
+void SCM___FF16__set_seed_rain(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_, std::vector<double> seed_rain) {
+  obj_->r_set_seed_rain(seed_rain);
+}
+// [[Rcpp::export]]
+void SCM___FF16__set_integrate_internals(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_, std::vector<std::string> names) {
+  obj_->r_set_integrate_internals(names);
+}
+// [[Rcpp::export]]
+std::vector<std::vector<double> > SCM___FF16__integrate_internals_total(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_, plant::util::index species_index) {
+  return obj_->r_integrate_internals_total(species_index);
+}
+// [[Rcpp::export]]
+std::vector<std::vector<double> > SCM___FF16__integrate_internals_cumulative(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_, plant::util::index species_index) {
+  return obj_->r_integrate_internals_cumulative(species_index);
+}
+// [[Rcpp::export]]
+void SCM___FF16__set_record_seeds(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_, bool record) {
+  obj_->r_set_record_seeds(record);
+}
+// [[Rcpp::export]]
+std::vector<std::vector<double> > SCM___FF16__seed_rain_disturbance(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_, std::vector<double> mean_interval) {
+  return obj_->r_seed_rain_disturbance(mean_interval);
+}
+// [[Rcpp::export]]
+std::vector<double> SCM___FF16__seed_rain_survival(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_, std::vector<double> pr_survival, double mean_interval) {
+  return obj_->r_seed_rain_survival(pr_survival, mean_interval);
+}
+// [[Rcpp::export]]
+Rcpp::List SCM___FF16__run_error(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_) {
+  return plant::run_scm_error(*obj_);
+}
+// [[Rcpp::export]]
 bool SCM___FF16__complete__get(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_) {
   return obj_->complete();
 }
@@ -1660,6 +1746,16 @@ std::vector<std::vector<double> > SCM___FF16__seed_rain_error__get(plant::RcppR6
   return obj_->r_seed_rain_error();
 }
 
+// [[Rcpp::export]]
+std::vector<double> SCM___FF16__integrate_internals_time__get(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_) {
+  return obj_->r_integrate_internals_time();
+}
+
+// [[Rcpp::export]]
+std::vector<double> SCM___FF16__seed_rain_record_time__get(plant::RcppR6::RcppR6<plant::SCM<plant::FF16_Strategy> > obj_) {
+  return obj_->r_seed_rain_record_time();
+}
+
 
 // [[Rcpp::export]]
 plant::SCM<plant::FF16r_Strategy> SCM___FF16r__ctor(plant::Parameters<plant::FF16r_Strategy> parameters) {
@@ -1694,6 +1790,38 @@ void SCM___FF16r__set_cohort_schedule_times(plant::RcppR6::RcppR6<plant::SCM<pla
   obj_->r_set_cohort_schedule_times(times);
 }
 // [[Rcpp::export]]
+void SCM___FF16r__set_seed_rain(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_, std::vector<double> seed_rain) {
+  obj_->r_set_seed_rain(seed_rain);
+}
+// [[Rcpp::export]]
+void SCM___FF16r__set_integrate_internals(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_, std::vector<std::string> names) {
+  obj_->r_set_integrate_internals(names);
+}
+// [[Rcpp::export]]
+std::vector<std::vector<double> > SCM___FF16r__integrate_internals_total(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_, plant::util::index species_index) {
+  return obj_->r_integrate_internals_total(species_index);
+}
+// [[Rcpp::export]]
+std::vector<std::vector<double> > SCM___FF16r__integrate_internals_cumulative(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_, plant::util::index species_index) {
+  return obj_->r_integrate_internals_cumulative(species_index);
+}
+// [[Rcpp::export]]
+void SCM___FF16r__set_record_seeds(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_, bool record) {
+  obj_->r_set_record_seeds(record);
+}
+// [[Rcpp::export]]
+std::vector<std::vector<double> > SCM___FF16r__seed_rain_disturbance(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_, std::vector<double> mean_interval) {
+  return obj_->r_seed_rain_disturbance(mean_interval);
+}
+// [[Rcpp::export]]
+std::vector<double> SCM___FF16r__seed_rain_survival(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_, std::vector<double> pr_survival, double mean_interval) {
+  return obj_->r_seed_rain_survival(pr_survival, mean_interval);
+}
+// [[Rcpp::export]]
+Rcpp::List SCM___FF16r__run_error(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_) {
+  return plant::run_scm_error(*obj_);
+}
+// [[Rcpp::export]]
 bool SCM___FF16r__complete__get(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_) {
   return obj_->complete();
 }
@@ -1751,6 +1879,16 @@ std::vector<std::vector<double> > SCM___FF16r__seed_rain_error__get(plant::RcppR
   return obj_->r_seed_rain_error();
 }
 
+// [[Rcpp::export]]
+std::vector<double> SCM___FF16r__integrate_internals_time__get(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_) {
+  return obj_->r_integrate_internals_time();
+}
+
+// [[Rcpp::export]]
+std::vector<double> SCM___FF16r__seed_rain_record_time__get(plant::RcppR6::RcppR6<plant::SCM<plant::FF16r_Strategy> > obj_) {
+  return obj_->r_seed_rain_record_time();
+}
+
 
 // [[Rcpp::export]]
 plant::StochasticSpecies<plant::FF16_Strategy> StochasticSpecies___FF16__ctor(plant::FF16_Strategy strategy) {
@@ -2252,6 +2390,110 @@ Rcpp::List StochasticPatchRunner___FF16r__state__get(plant::RcppR6::RcppR6<plant
 }
 
 
+// [[Rcpp::export]]
+plant::MeshSCM<plant::FF16_Strategy> MeshSCM___FF16__ctor(plant::Parameters<plant::FF16_Strategy> parameters) {
+  return plant::MeshSCM<plant::FF16_Strategy>(parameters);
+}
+// [[Rcpp::export]]
+void MeshSCM___FF16__run(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_) {
+  obj_->run();
+}
+// [[Rcpp::export]]
+void MeshSCM___FF16__advance(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_, double time) {
+  obj_->advance(time);
+}
+// [[Rcpp::export]]
+void MeshSCM___FF16__reset(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_) {
+  obj_->reset();
+}
+// [[Rcpp::export]]
+bool MeshSCM___FF16__complete__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_) {
+  return obj_->complete();
+}
+
+// [[Rcpp::export]]
+double MeshSCM___FF16__time__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_) {
+  return obj_->time();
+}
+
+// [[Rcpp::export]]
+std::vector<double> MeshSCM___FF16__seed_rains__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_) {
+  return obj_->seed_rains();
+}
+
+// [[Rcpp::export]]
+plant::Parameters<plant::FF16_Strategy> MeshSCM___FF16__parameters__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_) {
+  return obj_->r_parameters();
+}
+
+// [[Rcpp::export]]
+std::vector<double> MeshSCM___FF16__ode_times__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_) {
+  return obj_->r_ode_times();
+}
+
+// [[Rcpp::export]]
+std::vector<std::vector<double> > MeshSCM___FF16__heights__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_) {
+  return obj_->r_heights();
+}
+
+// [[Rcpp::export]]
+std::vector<std::vector<double> > MeshSCM___FF16__densities__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16_Strategy> > obj_) {
+  return obj_->r_densities();
+}
+
+
+// [[Rcpp::export]]
+plant::MeshSCM<plant::FF16r_Strategy> MeshSCM___FF16r__ctor(plant::Parameters<plant::FF16r_Strategy> parameters) {
+  return plant::MeshSCM<plant::FF16r_Strategy>(parameters);
+}
+// [[Rcpp::export]]
+void MeshSCM___FF16r__run(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_) {
+  obj_->run();
+}
+// [[Rcpp::export]]
+void MeshSCM___FF16r__advance(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_, double time) {
+  obj_->advance(time);
+}
+// [[Rcpp::export]]
+void MeshSCM___FF16r__reset(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_) {
+  obj_->reset();
+}
+// [[Rcpp::export]]
+bool MeshSCM___FF16r__complete__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_) {
+  return obj_->complete();
+}
+
+// [[Rcpp::export]]
+double MeshSCM___FF16r__time__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_) {
+  return obj_->time();
+}
+
+// [[Rcpp::export]]
+std::vector<double> MeshSCM___FF16r__seed_rains__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_) {
+  return obj_->seed_rains();
+}
+
+// [[Rcpp::export]]
+plant::Parameters<plant::FF16r_Strategy> MeshSCM___FF16r__parameters__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_) {
+  return obj_->r_parameters();
+}
+
+// [[Rcpp::export]]
+std::vector<double> MeshSCM___FF16r__ode_times__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_) {
+  return obj_->r_ode_times();
+}
+
+// [[Rcpp::export]]
+std::vector<std::vector<double> > MeshSCM___FF16r__heights__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_) {
+  return obj_->r_heights();
+}
+
+// [[Rcpp::export]]
+std::vector<std::vector<double> > MeshSCM___FF16r__densities__get(plant::RcppR6::RcppR6<plant::MeshSCM<plant::FF16r_Strategy> > obj_) {
+  return obj_->r_densities();
+}
+
+
 // [[Rcpp::export]]
 double cohort_schedule_max_time_default__Parameters___FF16(const plant::Parameters<plant::FF16_Strategy>& p) {
    return plant::cohort_schedule_max_time_default<plant::Parameters<plant::FF16_Strategy> >(p);
@@ -9,6 +9,9 @@ Control::Control() : integrator(15, 1, 0, 0) {
   plant_assimilation_tol = 1e-6;
   plant_assimilation_iterations = 1000;
   plant_assimilation_rule = 21;
+  plant_assimilation_knots = 0;
+  plant_assimilation_knots_width = 0.1;
+  plant_assimilation_tol_weight_max = 0.0;
 
   plant_seed_tol = 1e-8;
   plant_seed_iterations = 1000;
@@ -17,11 +20,16 @@ Control::Control() : integrator(15, 1, 0, 0) {
   cohort_gradient_direction = 1;
   cohort_gradient_richardson = false;
   cohort_gradient_richardson_depth = 4;
+  cohort_gradient_neighbour_gap = 0.0;
+  cohort_integration_cubic = false;
 
   environment_light_tol = 1e-6;
   environment_light_nbase = 17;
   environment_light_max_depth = 16;
   environment_light_rescale_usually = false;
+  environment_light_reuse_tol = 0.0;
+  environment_light_monotone = false;
+  environment_light_leaf_area = false;
 
   ode_step_size_initial = 1e-6;
   ode_step_size_min = 1e-6;
@@ -30,6 +38,8 @@ Control::Control() : integrator(15, 1, 0, 0) {
   ode_tol_abs       = 1e-6;
   ode_a_y           = 1.0;
   ode_a_dydt        = 0.0;
+  ode_step_size_pi  = false;
+  ode_step_size_estimate = false;
 
   schedule_nsteps   = 20;
   schedule_eps      = 1e-3;
@@ -37,6 +47,11 @@ Control::Control() : integrator(15, 1, 0, 0) {
   // This odd number is designed to agree with Daniel's implementation
   // of the model.
   schedule_patch_survival = 6.25302620663814e-05;
+  schedule_richardson = false;
+  schedule_end_tol = 0.0;
+  schedule_end_declines = 10;
+
+  mesh_n_cells = 200;
 
   equilibrium_nsteps   = 20;
   equilibrium_eps      = 1e-5;
@@ -33,6 +33,19 @@ double Disturbance::pr_survival_conditional(double time,
   return pr_survival(time) / pr_survival(time_start);
 }
 
+// Integral of pr_survival from 'time_start' to 'time_end'.  For the
+// Weibull this is an incomplete gamma function:
+//   int_a^b exp(-s t^k) dt = m (Q(1/k, s a^k) - Q(1/k, s b^k))
+// where Q is the regularised upper incomplete gamma function and m is
+// the mean interval.
+double Disturbance::pr_survival_integral(double time_start,
+                                         double time_end) const {
+  const double a = 1.0 / shape;
+  return mean_interval *
+    (R::pgamma(scale * pow(time_start, shape), a, 1.0, 0, 0) -
+     R::pgamma(scale * pow(time_end, shape), a, 1.0, 0, 0));
+}
+
 // Cumulative density function: this is the inverse of pr_survival
 double Disturbance::cdf(double p) const {
   return pow(log(p) / -scale, 1/shape);
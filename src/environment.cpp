@@ -1,5 +1,6 @@
 #include <plant/environment.h>
 #include <plant/parameters.h>
+#include <plant/util_post_rcpp.h> // to_rcpp_matrix
 
 namespace plant {
 
@@ -10,12 +11,26 @@ Environment::Environment(double disturbance_mean_interval,
     disturbance_regime(disturbance_mean_interval),
     seed_rain(seed_rain_),
     seed_rain_index(0),
-    light_environment_generator(make_interpolator(control)) {
+    light_environment_generator(make_interpolator(control)),
+    light_environment_leaf_area(control.environment_light_leaf_area),
+    light_environment_quadrature(control.plant_assimilation_knots),
+    light_environment_quadrature_width(control.plant_assimilation_knots_width),
+    canopy_openness_above(1.0) {
 }
 
 double Environment::canopy_openness(double height) const {
   const bool within_canopy = height <= light_environment.max();
-  return within_canopy ? light_environment.eval(height) : 1.0;
+  return within_canopy ?
+    canopy_openness_profile(light_environment.eval(height)) :
+    canopy_openness_above;
+}
+
+// Make the light environment constant, with no interpolator; this is
+// much cheaper than building one when many different light levels are
+// needed (e.g., lcp_whole_plant).
+void Environment::set_fixed_canopy_openness(double canopy_openness) {
+  clear_light_environment();
+  canopy_openness_above = canopy_openness;
 }
 
 // Computes the probability of survival from 0 to time.
@@ -38,6 +53,35 @@ void Environment::clear() {
 
 void Environment::clear_light_environment() {
   light_environment.clear();
+  light_environment_reference.clear();
+  light_environment_quadrature_openness.clear();
+  light_environment_quadrature_cache.clear();
+  canopy_openness_above = 1.0;
+}
+
+// Above the canopy the light is unobstructed, whatever
+// set_fixed_canopy_openness set before.
+void Environment::set_light_environment(const interpolator::Interpolator& profile) {
+  canopy_openness_above = 1.0;
+  light_environment = profile;
+  compute_light_environment_quadrature();
+}
+
+// Panels are at most Control::plant_assimilation_knots_width times as
+// wide as their height so that the rule also resolves the leaf area
+// distribution (q) of the plants, which varies sharply near the top
+// of each plant.
+void Environment::compute_light_environment_quadrature() {
+  light_environment_quadrature_openness.clear();
+  light_environment_quadrature_cache.clear();
+  if (light_environment_quadrature > 0 && light_environment.size() > 1) {
+    light_environment.compute_quadrature(light_environment_quadrature,
+                                         light_environment_quadrature_width);
+    for (auto y : light_environment.quadrature_y()) {
+      light_environment_quadrature_openness.push_back(
+        canopy_openness_profile(y));
+    }
+  }
 }
 
 double Environment::seed_rain_dt() const {
@@ -56,4 +100,17 @@ void Environment::r_set_seed_rain_index(util::index x) {
   set_seed_rain_index(x.check_bounds(seed_rain.size()));
 }
 
+// Canopy openness at the knots of the light environment, as a two
+// column matrix like Interpolator$xy; this differs from the light
+// environment itself when it holds extinction.
+SEXP Environment::r_light_environment_openness() const {
+  std::vector< std::vector<double> > xy;
+  xy.push_back(light_environment.get_x());
+  xy.push_back(light_environment.get_y());
+  for (auto& y : xy[1]) {
+    y = canopy_openness_profile(y);
+  }
+  return Rcpp::wrap(util::to_rcpp_matrix(xy));
+}
+
 }
@@ -0,0 +1,188 @@
+#include <plant.h>
+#include <plant/ff16_hyperpar.h>
+#include <map>
+
+namespace plant {
+namespace hyperpar {
+
+double solar_angle(double decimal_day_time, double latitude) {
+  const double day = std::floor(decimal_day_time);
+  const double time = (decimal_day_time - day) * 24;
+  const double lat_radians = latitude / 180 * M_PI;
+
+  // solar declination (radians) - angle b/w the earth-sun line and
+  // the equatorial plane
+  const double delta =
+    0.39785 * std::sin(4.869 + day / 365 * 2 * M_PI +
+                       0.03345 * std::sin(6.224 + day / 365 * 2 * M_PI));
+
+  // Hour angle - angular distance that earth has rotated in a day
+  const double hour_angle = (180 - time * 15) / 180 * M_PI;
+
+  return std::asin(std::sin(lat_radians) * std::sin(delta) +
+                   std::cos(lat_radians) * std::cos(delta) *
+                   std::cos(hour_angle));
+}
+
+double PAR_given_solar_angle(double solar_angle) {
+  if (solar_angle <= 0) {
+    return 0.0;
+  }
+  const double S_atmos = 1360, tau = 0.8, PAR_frac = 0.5;
+  const double mol_per_watt = 4.6 / 1e+06, sec_per_day = 3600 * 24;
+  // Relative path length through the atmosphere
+  const double M = 1 / std::cos(M_PI / 2 - solar_angle);
+  return S_atmos * PAR_frac * std::pow(tau, M) * mol_per_watt * sec_per_day;
+}
+
+namespace {
+
+double assimilation_rectangular_hyperbolae(double I, double A_max,
+                                           double theta, double QY) {
+  const double x = QY * I + A_max;
+  return (x - std::sqrt(x * x - 4 * theta * QY * I * A_max)) / (2 * theta);
+}
+
+double fit_rss(const std::vector<double>& E, const std::vector<double>& AA,
+               double p1, double p2) {
+  double tot = 0.0;
+  for (size_t i = 0; i < E.size(); ++i) {
+    const double r = AA[i] - p1 * E[i] / (p2 + E[i]);
+    tot += r * r;
+  }
+  return tot;
+}
+
+// Least squares fit of AA = p1 * E / (p2 + E) by Gauss-Newton with
+// step halving.  The starting point, step control and convergence
+// criterion (relative offset, Bates & Watts 1981) are those of the
+// nls() fit this replaces, so that the fitted values (and therefore
+// the FF16 default strategy) are unchanged, but without the overhead
+// of nls.
+std::vector<double> fit_saturating(const std::vector<double>& E,
+                                   const std::vector<double>& AA) {
+  const size_t max_iterations = 50;
+  const double tol = 1e-5, min_factor = 1.0 / 1024;
+
+  double p1 = 100, p2 = 0.2, factor = 1.0;
+  double rss = fit_rss(E, AA, p1, p2);
+  for (size_t it = 0; it < max_iterations; ++it) {
+    double a11 = 0, a12 = 0, a22 = 0, b1 = 0, b2 = 0;
+    for (size_t i = 0; i < E.size(); ++i) {
+      const double g = E[i] / (p2 + E[i]);
+      const double j1 = g, j2 = -p1 * g / (p2 + E[i]);
+      const double r = AA[i] - p1 * g;
+      a11 += j1 * j1; a12 += j1 * j2; a22 += j2 * j2;
+      b1 += j1 * r; b2 += j2 * r;
+    }
+    const double det = a11 * a22 - a12 * a12;
+    const double d1 = (a22 * b1 - a12 * b2) / det;
+    const double d2 = (a11 * b2 - a12 * b1) / det;
+
+    // Squared length of the residuals projected onto the tangent
+    // plane, relative to the remainder.
+    const double projected = b1 * d1 + b2 * d2;
+    if (std::sqrt(projected / (rss - projected)) < tol) {
+      return std::vector<double>{p1, p2};
+    }
+
+    bool accepted = false;
+    while (factor >= min_factor) {
+      const double p1_new = p1 + factor * d1, p2_new = p2 + factor * d2;
+      const double rss_new = fit_rss(E, AA, p1_new, p2_new);
+      if (rss_new <= rss) {
+        p1 = p1_new;
+        p2 = p2_new;
+        rss = rss_new;
+        factor = std::min(2 * factor, 1.0);
+        accepted = true;
+        break;
+      }
+      factor /= 2;
+    }
+    if (!accepted || !util::is_finite(p1) || !util::is_finite(p2)) {
+      break;
+    }
+  }
+  util::stop("Fitting annual assimilation curve failed to converge");
+  return std::vector<double>();
+}
+
+std::vector<double> compute_assimilation_fit(double A_max, double theta,
+                                             double QY, double k_I,
+                                             double latitude) {
+  // Only integrate over half year, as solar path is symmetrical
+  const std::vector<double> D = util::seq_len(0, 365.0 / 2, 10000);
+  std::vector<double> I;
+  I.reserve(D.size());
+  for (auto d : D) {
+    I.push_back(k_I * PAR_given_solar_angle(solar_angle(d, std::abs(latitude))));
+  }
+
+  const size_t n_E = 51;
+  std::vector<double> E, AA, A(D.size());
+  for (size_t i = 0; i < n_E; ++i) {
+    const double e = i * 0.02;
+    for (size_t j = 0; j < D.size(); ++j) {
+      A[j] = assimilation_rectangular_hyperbolae(I[j] * e, A_max, theta, QY);
+    }
+    E.push_back(e);
+    AA.push_back(2 * util::trapezium(D, A));
+  }
+
+  bool flat = true;
+  for (size_t i = 1; i < n_E && flat; ++i) {
+    flat = AA[i] - AA[i - 1] < 1e-8;
+  }
+  if (flat) {
+    // Curve fitting will fail if all values are zero, or potentially
+    // the same value.
+    return std::vector<double>{AA.back(), 0.0};
+  }
+  return fit_saturating(E, AA);
+}
+
+}
+
+std::vector<double> FF16_assimilation_fit(double A_max, double theta,
+                                          double QY, double k_I,
+                                          double latitude) {
+  typedef std::map<std::vector<double>, std::vector<double> > cache_type;
+  static cache_type cache;
+  // Guard against unbounded growth when sampling many traits.
+  const size_t cache_size_max = 10000;
+
+  const std::vector<double> key{A_max, theta, QY, k_I, latitude};
+  cache_type::const_iterator hit = cache.find(key);
+  if (hit != cache.end()) {
+    return hit->second;
+  }
+  std::vector<double> ret =
+    compute_assimilation_fit(A_max, theta, QY, k_I, latitude);
+  if (cache.size() >= cache_size_max) {
+    cache.clear();
+  }
+  cache[key] = ret;
+  return ret;
+}
+
+}
+}
+
+// Used by make_FF16_hyperpar; returns a 2 x length(narea) matrix with
+// fitted p1 and p2 in the rows.
+// [[Rcpp::export]]
+Rcpp::NumericMatrix FF16_approximate_annual_assimilation(
+  std::vector<double> narea, double narea_0, double B_lf1, double B_lf2,
+  double B_lf3, double B_lf5, double k_I, double latitude) {
+  Rcpp::NumericMatrix ret(2, static_cast<int>(narea.size()));
+  for (size_t i = 0; i < narea.size(); ++i) {
+    const double A_max = B_lf1 * std::pow(narea[i] / narea_0, B_lf5);
+    std::vector<double> fit =
+      plant::hyperpar::FF16_assimilation_fit(A_max, B_lf2, B_lf3, k_I,
+                                             latitude);
+    ret(0, i) = fit[0];
+    ret(1, i) = fit[1];
+  }
+  return ret;
+}
@@ -1,6 +1,7 @@
 #include <plant/ff16_strategy.h>
 #include <plant/uniroot.h>
 #include <plant/qag.h>
+#include <plant/qk_rules.h>
 #include <plant/environment.h>
 #include <RcppCommon.h> // NA_REAL
 
@@ -91,6 +92,7 @@ FF16_Strategy::FF16_Strategy() {
   // Will get computed properly by prepare_strategy
   height_0 = NA_REAL;
   eta_c    = NA_REAL;
+  eta_int  = 0;
 
   name = "FF16";
 }
@@ -157,10 +159,11 @@ double FF16_Strategy::mass_above_ground(double mass_leaf, double mass_bark,
 // one-shot update of the scm variables
 void FF16_Strategy::scm_vars(const Environment& environment,
                               bool reuse_intervals,
-                              Plant_internals& vars) {
+                              Plant_internals& vars,
+                              double tol_scale) {
   const double net_mass_production_dt_ =
     net_mass_production_dt(environment, vars.height, vars.area_leaf,
-                           reuse_intervals);
+                           reuse_intervals, tol_scale);
   if (net_mass_production_dt_ > 0) {
     const double fraction_allocation_reproduction_ =
       fraction_allocation_reproduction(vars.height);
@@ -199,12 +202,29 @@ void FF16_Strategy::scm_vars(const Environment& environment,
 double FF16_Strategy::assimilation(const Environment& environment,
                                     double height,
                                     double area_leaf,
-                                    bool reuse_intervals) {
+                                    bool reuse_intervals,
+                                    double tol_scale) {
   const bool over_distribution = control.plant_assimilation_over_distribution;
   const double x_min = 0.0, x_max = over_distribution ? 1.0 : height;
 
   double A = 0.0;
 
+  if (control.plant_assimilation_knots > 0 &&
+      environment.light_environment.quadrature_points() > 0) {
+    return area_leaf * assimilation_knots(environment, height);
+  }
+
+  if (!assimilation_fraction.empty()) {
+    // Equivalent to integrating compute_assimilation_x with the fixed
+    // rule, using the tabulated values from prepare_strategy.
+    for (size_t i = 0; i < assimilation_fraction.size(); ++i) {
+      const double z = assimilation_fraction[i] * height;
+      A += assimilation_weight[i] *
+        assimilation_leaf(environment.canopy_openness(z));
+    }
+    return area_leaf * A;
+  }
+
   std::function<double(double)> f;
   if (over_distribution) {
     f = [&] (double x) -> double {
@@ -219,7 +239,9 @@ double FF16_Strategy::assimilation(const Environment& environment,
   if (control.plant_assimilation_adaptive && reuse_intervals) {
     A = control.integrator.integrate_with_last_intervals(f, x_min, x_max);
   } else {
-    A = control.integrator.integrate(f, x_min, x_max);
+    // tol_scale (usually 1) comes from the cohort's share of its
+    // species; see Species::assimilation_tol_scale.
+    A = control.integrator.integrate(f, x_min, x_max, tol_scale);
   }
 
   return area_leaf * A;
@@ -248,6 +270,78 @@ double FF16_Strategy::compute_assimilation_p(double p, double height,
   return assimilation_leaf(environment.canopy_openness(Qp(p, height)));
 }
 
+// The integrand of [eqn 12] is smooth between the knots of the light
+// environment but not across them, so with
+// Control::plant_assimilation_knots set the integral is computed with
+// a Gauss-Legendre rule on each interval between knots (this is the
+// same integral whether or not plant_assimilation_over_distribution
+// is set).  With u = z / H (H being the top of the light environment)
+// and v = height / H,
+//   q(z, height) = 2 eta (u^eta / v^eta - u^(2 eta) / v^(2 eta)) / z
+// so the integral over the intervals below the plant follows from two
+// cumulative sums over the rule that do not depend on the plant.
+// These depend on the strategy only through a_p1, a_p2 and eta, and
+// are computed once for each light environment, which keeps them for
+// every plant with those parameters; only the interval containing the
+// top of the plant is integrated separately.
+double FF16_Strategy::assimilation_knots(const Environment& environment,
+                                         double height) const {
+  const interpolator::Interpolator& light_environment =
+    environment.light_environment;
+  const std::vector<double>& knots = light_environment.quadrature_knots();
+
+  auto f_sums = [&] () -> Environment::quadrature_sums {
+    const std::vector<double>& x = light_environment.quadrature_x();
+    const std::vector<double>& w = light_environment.quadrature_w();
+    const std::vector<size_t>& index = light_environment.quadrature_index();
+    const std::vector<double>& E = environment.canopy_openness_quadrature();
+    const double H = knots.back();
+    double sum1 = 0.0, sum2 = 0.0;
+    Environment::quadrature_sums ret(2, std::vector<double>(1, 0.0));
+    for (size_t k = 1; k < index.size(); ++k) {
+      for (size_t i = index[k - 1]; i < index[k]; ++i) {
+        const double tmp = pow_eta(x[i] / H);
+        const double a = w[i] * assimilation_leaf(E[i]) * tmp / x[i];
+        sum1 += a;
+        sum2 += a * tmp;
+      }
+      ret[0].push_back(sum1);
+      ret[1].push_back(sum2);
+    }
+    return ret;
+  };
+  const Environment::quadrature_sums& sums =
+    environment.light_environment_quadrature_sums({a_p1, a_p2, eta}, f_sums);
+
+  // Last knot at or below the top of the plant
+  const size_t k =
+    std::upper_bound(knots.begin(), knots.end(), height) - knots.begin() - 1;
+  double A = 0.0;
+  if (k > 0) {
+    const double tmp = pow_eta(height / knots.back());
+    A = 2 * eta * (sums[0][k] / tmp - sums[1][k] / tmp / tmp);
+  }
+
+  // The rest, split in the same way as the light environment's rule
+  if (height > knots[k]) {
+    const std::vector<double>& gx = light_environment.quadrature_rule_x();
+    const std::vector<double>& gw = light_environment.quadrature_rule_w();
+    const size_t n = gx.size();
+    const double a = knots[k];
+    const size_t m = static_cast<size_t>(
+      std::ceil((height - a) / (light_environment.quadrature_width() * height)));
+    const double half = (height - a) / m / 2;
+    for (size_t i = 0; i < m; ++i) {
+      const double mid = a + (2 * i + 1) * half;
+      for (size_t j = 0; j < n; ++j) {
+        A += half * gw[j] *
+          compute_assimilation_h(mid + half * gx[j], height, environment);
+      }
+    }
+  }
+  return A;
+}
+
 // [Appendix S6] Per-leaf photosynthetic rate.
 // Here, `x` is openness, ranging from 0 to 1.
 double FF16_Strategy::assimilation_leaf(double x) const {
@@ -318,7 +412,8 @@ double FF16_Strategy::net_mass_production_dt_A(double assimilation, double respi
 // Used by germination_probability() and scm_vars().
 double FF16_Strategy::net_mass_production_dt(const Environment& environment,
                                 double height, double area_leaf_,
-                                bool reuse_intervals) {
+                                bool reuse_intervals,
+                                double tol_scale) {
   const double mass_leaf_    = mass_leaf(area_leaf_);
   const double area_sapwood_ = area_sapwood(area_leaf_);
   const double mass_sapwood_ = mass_sapwood(area_sapwood_, height);
@@ -326,7 +421,8 @@ double FF16_Strategy::net_mass_production_dt(const Environment& environment,
   const double mass_bark_    = mass_bark(area_bark_, height);
   const double mass_root_    = mass_root(area_leaf_);
   const double assimilation_ = assimilation(environment, height,
-                                            area_leaf_, reuse_intervals);
+                                            area_leaf_, reuse_intervals,
+                                            tol_scale);
   const double respiration_ =
     respiration(mass_leaf_, mass_sapwood_, mass_bark_, mass_root_);
   const double turnover_ =
@@ -352,9 +448,12 @@ double FF16_Strategy::fecundity_dt(double net_mass_production_dt,
 }
 
 double FF16_Strategy::darea_leaf_dmass_live(double area_leaf) const {
+  // NOTE: dmass_bark_darea_leaf is a multiple of
+  // dmass_sapwood_darea_leaf; expanding it here saves a call to pow.
+  const double dmass_sapwood_darea_leaf_ = dmass_sapwood_darea_leaf(area_leaf);
   return 1.0/(  dmass_leaf_darea_leaf(area_leaf)
-              + dmass_sapwood_darea_leaf(area_leaf)
-              + dmass_bark_darea_leaf(area_leaf)
+              + dmass_sapwood_darea_leaf_
+              + a_b1 * dmass_sapwood_darea_leaf_
               + dmass_root_darea_leaf(area_leaf));
 }
 
@@ -515,7 +614,7 @@ double FF16_Strategy::area_leaf_above(double z, double height,
 
 // [eqn  9] Probability density of leaf area at height `z`
 double FF16_Strategy::q(double z, double height) const {
-  const double tmp = pow(z / height, eta);
+  const double tmp = pow_eta(z / height);
   return 2 * eta * (1 - tmp) * tmp / z;
 }
 
@@ -525,7 +624,7 @@ double FF16_Strategy::Q(double z, double height) const {
   if (z > height) {
     return 0.0;
   }
-  const double tmp = 1.0-pow(z / height, eta);
+  const double tmp = 1.0-pow_eta(z / height);
   return tmp * tmp;
 }
 
@@ -535,6 +634,10 @@ double FF16_Strategy::Qp(double x, double height) const { // x in [0,1], uncheck
   return pow(1 - sqrt(x), (1/eta)) * height;
 }
 
+double FF16_Strategy::pow_eta(double x) const {
+  return eta_int > 0 ? util::ipow(x, eta_int) : pow(x, eta);
+}
+
 // The aim is to find a plant height that gives the correct seed mass.
 double FF16_Strategy::height_seed(void) const {
 
@@ -563,6 +666,27 @@ void FF16_Strategy::prepare_strategy() {
   control.initialize();
   // NOTE: this pre-computes something to save a very small amount of time
   eta_c = 1 - 2/(1 + eta) + 1/(1 + 2*eta);
+  // NOTE: eta is 12 by default, in which case q and Q can avoid pow.
+  eta_int = 0;
+  if (eta > 0 && eta <= 64 && util::identical(eta, std::round(eta))) {
+    eta_int = static_cast<size_t>(eta);
+  }
+  // NOTE: Tabulate the fixed integration rule (needs eta, above).
+  // Over the distribution the integrand is assimilation at Qp(x, h),
+  // over height it is assimilation at x h, weighted by q(x h, h); as
+  // q(x h, h) = q(x, 1) / h this gives a weight independent of h.
+  assimilation_fraction.clear();
+  assimilation_weight.clear();
+  if (!control.integrator.is_adaptive()) {
+    const std::vector<double> x = control.integrator.integrate_vector_x(0, 1);
+    const std::vector<double> w = control.integrator.integrate_vector_w(0, 1);
+    const bool over_distribution =
+      control.plant_assimilation_over_distribution;
+    for (size_t i = 0; i < x.size(); ++i) {
+      assimilation_fraction.push_back(over_distribution ? Qp(x[i], 1.0) : x[i]);
+      assimilation_weight.push_back(over_distribution ? w[i] : w[i] * q(x[i], 1.0));
+    }
+  }
   // NOTE: Also pre-computing, though less trivial
   height_0 = height_seed();
   area_leaf_0 = area_leaf(height_0);
@@ -1,5 +1,6 @@
 #include <plant/interpolator.h>
 #include <plant/util.h>
+#include <plant/qk_rules.h>
 #include <plant/util_post_rcpp.h> // to_rcpp_matrix
 #include <Rcpp.h>
 
@@ -22,9 +23,14 @@ void Interpolator::init(const std::vector<double>& x_,
 // and 'y'.
 void Interpolator::initialise() {
   if (x.size() > 0) {
-    tk_spline.set_points(x, y);
+    if (monotone) {
+      tk_spline.set_points_monotone(x, y);
+    } else {
+      tk_spline.set_points(x, y);
+    }
     active = true;
   }
+  clear_quadrature();
 }
 
 // Support for adding points in turn (assumes monotonic increasing in
@@ -39,6 +45,7 @@ void Interpolator::clear() {
   x.clear();
   y.clear();
   active = false;
+  clear_quadrature();
 }
 
 // Compute the value of the interpolated function at point `x=u`
@@ -70,6 +77,79 @@ std::vector<double> Interpolator::get_y() const {
   return y;
 }
 
+void Interpolator::set_monotone(bool x) {
+  monotone = x;
+}
+
+bool Interpolator::is_monotone() const {
+  return monotone;
+}
+
+void Interpolator::compute_quadrature(size_t n, double width) {
+  check_active();
+  if (!(width > 0.0)) {
+    util::stop("Quadrature panel width must be positive");
+  }
+  clear_quadrature();
+  quad_gx = quadrature::gauss_legendre_x(n);
+  quad_gw = quadrature::gauss_legendre_w(n);
+  quad_index.push_back(0);
+  for (size_t i = 1; i < size(); ++i) {
+    const double a = x[i - 1], b = x[i];
+    const size_t m = static_cast<size_t>(std::ceil((b - a) / (width * b)));
+    const double half = (b - a) / m / 2;
+    for (size_t k = 0; k < m; ++k) {
+      const double mid = a + (2 * k + 1) * half;
+      for (size_t j = 0; j < n; ++j) {
+        const double u = mid + half * quad_gx[j];
+        quad_x.push_back(u);
+        quad_w.push_back(half * quad_gw[j]);
+        quad_y.push_back(eval(u));
+      }
+    }
+    quad_index.push_back(quad_x.size());
+  }
+  quad_n = n;
+  quad_width = width;
+}
+
+size_t Interpolator::quadrature_points() const {
+  return quad_n;
+}
+
+double Interpolator::quadrature_width() const {
+  return quad_width;
+}
+
+// The knots that the rule is split at (those of the interpolator).
+const std::vector<double>& Interpolator::quadrature_knots() const {
+  return x;
+}
+
+const std::vector<double>& Interpolator::quadrature_rule_x() const {
+  return quad_gx;
+}
+
+const std::vector<double>& Interpolator::quadrature_rule_w() const {
+  return quad_gw;
+}
+
+const std::vector<size_t>& Interpolator::quadrature_index() const {
+  return quad_index;
+}
+
+const std::vector<double>& Interpolator::quadrature_x() const {
+  return quad_x;
+}
+
+const std::vector<double>& Interpolator::quadrature_w() const {
+  return quad_w;
+}
+
+const std::vector<double>& Interpolator::quadrature_y() const {
+  return quad_y;
+}
+
 // Get the (x,y) pairs in the Interpolator as a two-column matrix
 SEXP Interpolator::r_get_xy() const {
   std::vector< std::vector<double> > xy;
@@ -96,5 +176,16 @@ void Interpolator::check_active() const {
   }
 }
 
+void Interpolator::clear_quadrature() {
+  quad_x.clear();
+  quad_w.clear();
+  quad_y.clear();
+  quad_gx.clear();
+  quad_gw.clear();
+  quad_index.clear();
+  quad_n = 0;
+  quad_width = 0.0;
+}
+
 }
 }
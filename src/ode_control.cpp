@@ -5,12 +5,13 @@ namespace plant {
 namespace ode {
 
 OdeControl::OdeControl() : OdeControl(1e-8, 1e-8, 1.0, 0.0,
-				      1e-8, 10.0, 1e-6) {
+				      1e-8, 10.0, 1e-6, false, false) {
 }
 OdeControl::OdeControl(double tol_abs_, double tol_rel_,
 		       double a_y_, double a_dydt_,
 		       double step_size_min_, double step_size_max_,
-		       double step_size_initial_)
+		       double step_size_initial_,
+		       bool step_size_pi_, bool step_size_estimate_)
   : tol_abs(tol_abs_),
     tol_rel(tol_rel_),
     a_y(a_y_),
@@ -18,7 +19,10 @@ OdeControl::OdeControl(double tol_abs_, double tol_rel_,
     step_size_min(step_size_min_),
     step_size_max(step_size_max_),
     step_size_initial(step_size_initial_),
-    last_step_size_shrank(false) {
+    step_size_pi(step_size_pi_),
+    step_size_estimate(step_size_estimate_),
+    last_step_size_shrank(false),
+    last_error(1.0) {
 }
 
 double OdeControl::adjust_step_size(size_t dim, size_t ord,
@@ -48,6 +52,20 @@ double OdeControl::adjust_step_size(size_t dim, size_t ord,
       step_size = step_size_min;
       util::stop("Step size became too small");
     }
+  } else if (step_size_pi) {
+    // PI control (Gustafsson 1991): as well as the current error, take
+    // account of the trend from the last accepted step, which damps
+    // the oscillation between growing the step and rejecting it.  This
+    // settles at an error of S; the step may shrink here, but only by
+    // as much as is needed to avoid a rejection next time.
+    const double k_i = 0.3 / ord, k_p = 0.4 / ord;
+    const double err = std::max(rmax, 1e-4);
+    double r = pow(S / err, k_i) * pow(last_error / err, k_p);
+    // Following a rejection, don't grow the step again straight away.
+    r = util::clamp(r, 0.2, last_step_size_shrank ? 1.0 : 5.0);
+    step_size = std::min(step_size * r, step_size_max);
+    last_error = err;
+    last_step_size_shrank = false;
   } else if (rmax < 0.5) {
     // increase step, no more than factor of 5
     double r = S / pow (rmax, 1.0 / (ord + 1.0));
@@ -82,5 +100,11 @@ bool OdeControl::step_size_shrank() const {
   return last_step_size_shrank;
 }
 
+// The error history belongs to the system being solved, so this is
+// forgotten when the system is reset or resized.
+void OdeControl::reset_step_size_history() {
+  last_error = 1.0;
+}
+
 }
 }
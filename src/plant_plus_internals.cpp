@@ -1,4 +1,6 @@
 #include <plant/plant_plus_internals.h>
+#include <plant/util.h>
+#include <map>
 #include <R.h>
 
 namespace plant {
@@ -60,4 +62,67 @@ PlantPlus_internals::PlantPlus_internals()
   ddiameter_stem_darea_stem(NA_REAL) {
 }
 
+PlantPlus_internals_member plant_plus_internals_member(const std::string& name) {
+  typedef std::map<std::string, PlantPlus_internals_member> lookup_type;
+  static const lookup_type lookup = {
+    {"mass_leaf", &PlantPlus_internals::mass_leaf},
+    {"area_leaf", &PlantPlus_internals::area_leaf},
+    {"height", &PlantPlus_internals::height},
+    {"area_sapwood", &PlantPlus_internals::area_sapwood},
+    {"mass_sapwood", &PlantPlus_internals::mass_sapwood},
+    {"area_bark", &PlantPlus_internals::area_bark},
+    {"mass_bark", &PlantPlus_internals::mass_bark},
+    {"area_heartwood", &PlantPlus_internals::area_heartwood},
+    {"mass_heartwood", &PlantPlus_internals::mass_heartwood},
+    {"area_stem", &PlantPlus_internals::area_stem},
+    {"mass_root", &PlantPlus_internals::mass_root},
+    {"mass_live", &PlantPlus_internals::mass_live},
+    {"mass_total", &PlantPlus_internals::mass_total},
+    {"mass_above_ground", &PlantPlus_internals::mass_above_ground},
+    {"diameter_stem", &PlantPlus_internals::diameter_stem},
+    {"assimilation", &PlantPlus_internals::assimilation},
+    {"respiration", &PlantPlus_internals::respiration},
+    {"turnover", &PlantPlus_internals::turnover},
+    {"net_mass_production_dt", &PlantPlus_internals::net_mass_production_dt},
+    {"fraction_allocation_reproduction", &PlantPlus_internals::fraction_allocation_reproduction},
+    {"fraction_allocation_growth", &PlantPlus_internals::fraction_allocation_growth},
+    {"fecundity_dt", &PlantPlus_internals::fecundity_dt},
+    {"area_leaf_dt", &PlantPlus_internals::area_leaf_dt},
+    {"darea_leaf_dmass_live", &PlantPlus_internals::darea_leaf_dmass_live},
+    {"height_dt", &PlantPlus_internals::height_dt},
+    {"area_heartwood_dt", &PlantPlus_internals::area_heartwood_dt},
+    {"mass_heartwood_dt", &PlantPlus_internals::mass_heartwood_dt},
+    {"mortality_dt", &PlantPlus_internals::mortality_dt},
+    {"mortality", &PlantPlus_internals::mortality},
+    {"fecundity", &PlantPlus_internals::fecundity},
+    {"dheight_darea_leaf", &PlantPlus_internals::dheight_darea_leaf},
+    {"dmass_sapwood_darea_leaf", &PlantPlus_internals::dmass_sapwood_darea_leaf},
+    {"dmass_bark_darea_leaf", &PlantPlus_internals::dmass_bark_darea_leaf},
+    {"dmass_root_darea_leaf", &PlantPlus_internals::dmass_root_darea_leaf},
+    {"area_sapwood_dt", &PlantPlus_internals::area_sapwood_dt},
+    {"area_bark_dt", &PlantPlus_internals::area_bark_dt},
+    {"area_stem_dt", &PlantPlus_internals::area_stem_dt},
+    {"diameter_stem_dt", &PlantPlus_internals::diameter_stem_dt},
+    {"mass_root_dt", &PlantPlus_internals::mass_root_dt},
+    {"mass_live_dt", &PlantPlus_internals::mass_live_dt},
+    {"mass_total_dt", &PlantPlus_internals::mass_total_dt},
+    {"mass_above_ground_dt", &PlantPlus_internals::mass_above_ground_dt},
+    {"ddiameter_stem_darea_stem", &PlantPlus_internals::ddiameter_stem_darea_stem},
+  };
+  lookup_type::const_iterator it = lookup.find(name);
+  if (it == lookup.end()) {
+    util::stop("Unknown variable: " + name);
+  }
+  return it->second;
+}
+
+std::vector<PlantPlus_internals_member>
+plant_plus_internals_members(const std::vector<std::string>& names) {
+  std::vector<PlantPlus_internals_member> ret;
+  for (const auto& n : names) {
+    ret.push_back(plant_plus_internals_member(n));
+  }
+  return ret;
+}
+
 }
@@ -10,12 +10,21 @@ Environment fixed_environment(double canopy_openness,
   std::vector<double> y = {canopy_openness, canopy_openness, canopy_openness};
   interpolator::Interpolator env;
   env.init(x, y);
-  Parameters<FF16_Strategy> p;
-  Environment ret(make_environment(p));
+  Environment ret(fixed_environment());
   ret.light_environment = env;
   return ret;
 }
 
+// NOTE: This avoids make_environment(Parameters<T>()) because the
+// Parameters constructor calls back into R (to get the
+// hyperparameterisation function), but the default disturbance
+// interval here should match the one there.
+Environment fixed_environment() {
+  const double disturbance_mean_interval = 30.0;
+  return Environment(disturbance_mean_interval, std::vector<double>(),
+                     Control());
+}
+
 }
 }
 
@@ -59,3 +68,39 @@ double FF16_lcp_whole_plant(plant::PlantPlus<plant::FF16_Strategy> p) {
 double FF16r_lcp_whole_plant(plant::PlantPlus<plant::FF16r_Strategy> p) {
   return plant::tools::lcp_whole_plant(p);
 }
+
+// [[Rcpp::export]]
+std::vector<double>
+FF16_lcp_whole_plants(std::vector<plant::FF16_Strategy> strategies,
+                      double height) {
+  return plant::tools::lcp_whole_plants(strategies, height);
+}
+// [[Rcpp::export]]
+std::vector<double>
+FF16r_lcp_whole_plants(std::vector<plant::FF16r_Strategy> strategies,
+                       double height) {
+  return plant::tools::lcp_whole_plants(strategies, height);
+}
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix
+FF16_grow_plants_to_size_times(std::vector<plant::FF16_Strategy> strategies,
+                               std::vector<double> sizes,
+                               std::string size_name,
+                               plant::Environment env,
+                               double time_max) {
+  return plant::util::to_rcpp_matrix(
+    plant::tools::grow_plants_to_size_times(strategies, sizes, size_name,
+                                            env, time_max));
+}
+// [[Rcpp::export]]
+Rcpp::NumericMatrix
+FF16r_grow_plants_to_size_times(std::vector<plant::FF16r_Strategy> strategies,
+                                std::vector<double> sizes,
+                                std::string size_name,
+                                plant::Environment env,
+                                double time_max) {
+  return plant::util::to_rcpp_matrix(
+    plant::tools::grow_plants_to_size_times(strategies, sizes, size_name,
+                                            env, time_max));
+}
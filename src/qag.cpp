@@ -15,6 +15,7 @@ QAG::QAG(size_t rule, size_t max_iterations, double atol, double rtol)
     limit(max_iterations),
     epsabs(atol),
     epsrel(rtol),
+    tol_scale(1.0),
     area(NA_REAL),
     error(NA_REAL),
     iteration(0),
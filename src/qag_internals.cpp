@@ -1,28 +1,37 @@
 #include <plant/qag_internals.h>
 #include <plant/util.h>
 
-#include <algorithm> // min_element, max_element
+#include <algorithm> // push_heap, pop_heap
 
 namespace plant {
 namespace quadrature {
 namespace internal {
+namespace {
+// Orders points so that the heap has the largest error at the front.
+bool smaller_error(const workspace::point& x, const workspace::point& y) {
+  return x.error < y.error;
+}
+}
+
 void workspace::clear() {
   return points.clear();
 }
 
-workspace::point workspace::worst_point() const {
+void workspace::reserve(size_t n) {
+  points.reserve(n);
+}
+
+const workspace::point& workspace::worst_point() const {
   return points.front();
 }
 
+// Replace the worst point with its two halves.
 void workspace::update(point el1, point el2) {
-  drop_worst();
-  if (el1.error > el2.error) {
-    insert_forward(el1);
-    insert_backward(el2);
-  } else {
-    insert_forward(el2);
-    insert_backward(el1);
-  }
+  std::pop_heap(points.begin(), points.end(), smaller_error);
+  points.back() = el1;
+  std::push_heap(points.begin(), points.end(), smaller_error);
+  points.push_back(el2);
+  std::push_heap(points.begin(), points.end(), smaller_error);
 }
 
 double workspace::total_area() const {
@@ -45,16 +54,10 @@ void workspace::push_back(point el) {
   points.push_back(el);
 }
 
-void workspace::insert_forward(point el) {
-  points.insert(search_forward(el.error), el);
-}
-
-void workspace::insert_backward(point el) {
-  points.insert(search_backward(el.error), el);
-}
-
 intervals_type workspace::get_intervals() const {
   std::vector<double> a, b;
+  a.reserve(points.size());
+  b.reserve(points.size());
   for (points_const_iter p = points.begin(); p != points.end(); ++p) {
     a.push_back(p->a);
     b.push_back(p->b);
@@ -65,45 +68,17 @@ intervals_type workspace::get_intervals() const {
   return ret;
 }
 
-void workspace::drop_worst() {
-  points.pop_front();
-}
-
-// Search forward, from the beginning of the list, until we find an
-// error estimate *smaller* than error.  Return the iterator pointing
-// at that position, so that std::insert will insert a new value
-// *before* this point.
-workspace::points_iter workspace::search_forward(double error) {
-  points_iter p = points.begin();
-  while (p != points.end() && p->error > error) {
-    ++p;
+void workspace::rescale(double min, double max) {
+  double min_old = points.front().a, max_old = points.front().b;
+  for (points_const_iter p = points.begin(); p != points.end(); ++p) {
+    min_old = std::min(min_old, p->a);
+    max_old = std::max(max_old, p->b);
+  }
+  const double scale = (max - min) / (max_old - min_old);
+  for (points_iter p = points.begin(); p != points.end(); ++p) {
+    p->a = min + (p->a - min_old) * scale;
+    p->b = min + (p->b - min_old) * scale;
   }
-  return p;
-}
-
-// Search backwards
-workspace::points_iter workspace::search_backward(double error) {
-  points_iter p = points.end();
-  do {
-    --p;
-  } while (p != points.begin() && p->error < error);
-  return ++p;
-}
-
-intervals_type rescale_intervals(intervals_type x,
-                                 double min, double max) {
-  std::vector<double> a = x[0], b = x[1];
-  const double
-    min_old = *std::min_element(a.begin(), a.end()),
-    max_old = *std::max_element(b.begin(), b.end());
-
-  util::rescale(a.begin(), a.end(), min_old, max_old, min, max);
-  util::rescale(b.begin(), b.end(), min_old, max_old, min, max);
-
-  intervals_type ret;
-  ret.push_back(a);
-  ret.push_back(b);
-  return ret;
 }
 
 // This is useful in debugging, but never actually used.
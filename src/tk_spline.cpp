@@ -1,4 +1,5 @@
 #include <tk/spline.h>
+#include <cmath>
 
 namespace tk {
 
@@ -193,13 +194,77 @@ void spline::set_points(const std::vector<double>& x,
    }
 
    // for the right boundary we define
-   // f_{n-1}(x) = b*(x-x_{n-1})^2 + c*(x-x_{n-1}) + y_{n-1}
+   // f_{n-1}(x) = c*(x-x_{n-1}) + y_{n-1}
+   // (both ends extrapolate linearly; see operator())
    double h=x[n-1]-x[n-2];
-   // m_b[n-1] is determined by the boundary condition
    m_a[n-1]=0.0;
    m_c[n-1]=3.0*m_a[n-2]*h*h+2.0*m_b[n-2]*h+m_c[n-2];   // = f'_{n-2}(x_{n-1})
 }
 
+// Piecewise cubic Hermite interpolation with the derivatives chosen
+// (Fritsch & Butland 1984, as in Matlab's pchip) so that the
+// interpolant is monotone wherever the data are.  Unlike the cubic
+// spline the coefficients depend only on neighbouring points, so no
+// system of equations needs solving.
+void spline::set_points_monotone(const std::vector<double>& x,
+                                 const std::vector<double>& y) {
+   assert(x.size()==y.size());
+   m_x=x;
+   m_y=y;
+   int   n=x.size();
+   for(int i=0; i<n-1; i++) {
+      assert(m_x[i]<m_x[i+1]);
+   }
+
+   std::vector<double> h(n-1), delta(n-1), d(n);
+   for(int i=0; i<n-1; i++) {
+      h[i]=x[i+1]-x[i];
+      delta[i]=(y[i+1]-y[i])/h[i];
+   }
+
+   if(n==2) {
+      d[0]=d[1]=delta[0];
+   } else {
+      // interior derivatives: weighted harmonic mean of the adjacent
+      // slopes, or zero at local extrema
+      for(int i=1; i<n-1; i++) {
+         if(delta[i-1]*delta[i] > 0.0) {
+            const double w1=2.0*h[i]+h[i-1], w2=h[i]+2.0*h[i-1];
+            d[i]=(w1+w2)/(w1/delta[i-1]+w2/delta[i]);
+         } else {
+            d[i]=0.0;
+         }
+      }
+      // end derivatives: shape-preserving three point formula
+      d[0]=pchip_end(h[0], h[1], delta[0], delta[1]);
+      d[n-1]=pchip_end(h[n-2], h[n-3], delta[n-2], delta[n-3]);
+   }
+
+   // f(x) = a*(x-x_i)^3 + b*(x-x_i)^2 + c*(x-x_i) + y_i
+   m_a.resize(n);
+   m_b.resize(n);
+   m_c.resize(n);
+   for(int i=0; i<n-1; i++) {
+      m_a[i]=(d[i]+d[i+1]-2.0*delta[i])/(h[i]*h[i]);
+      m_b[i]=(3.0*delta[i]-2.0*d[i]-d[i+1])/h[i];
+      m_c[i]=d[i];
+   }
+   // end coefficients, for linear extrapolation to the right
+   m_a[n-1]=0.0;
+   m_b[n-1]=0.0;
+   m_c[n-1]=d[n-1];
+}
+
+double spline::pchip_end(double h0, double h1, double delta0, double delta1) {
+   double d=((2.0*h0+h1)*delta0-h0*delta1)/(h0+h1);
+   if(d*delta0 <= 0.0) {
+      d=0.0;
+   } else if(delta0*delta1 <= 0.0 && std::abs(d) > std::abs(3.0*delta0)) {
+      d=3.0*delta0;
+   }
+   return d;
+}
+
 double spline::operator() (double x) const {
    size_t n=m_x.size();
    // find the closest point m_x[idx] < x, idx=0 even if x<m_x[0]
@@ -210,11 +275,11 @@ double spline::operator() (double x) const {
    double h=x-m_x[idx];
    double interpol;
    if(x<m_x[0]) {
-      // extrapolation to the left
-      interpol=((m_b[0])*h + m_c[0])*h + m_y[0];
+      // linear extrapolation to the left
+      interpol=m_c[0]*h + m_y[0];
    } else if(x>m_x[n-1]) {
-      // extrapolation to the right
-      interpol=((m_b[n-1])*h + m_c[n-1])*h + m_y[n-1];
+      // linear extrapolation to the right
+      interpol=m_c[n-1]*h + m_y[n-1];
    } else {
       // interpolation
       interpol=((m_a[idx]*h + m_b[idx])*h + m_c[idx])*h + m_y[idx];
@@ -90,6 +90,32 @@ std::vector<double> local_error_integration(const std::vector<double>& x,
   return ret;
 }
 
+// The same idea, but with integration by local cubic interpolation:
+// the difference between the integral over [x_{i-1}, x_{i+1}] with
+// and without the point x_i, where each is computed from the same
+// stencils that integrate_local_cubic would use.
+std::vector<double> local_error_integration_cubic(const std::vector<double>& x,
+                                                  const std::vector<double>& y,
+                                                  double scal) {
+  check_length(x.size(), y.size());
+  const size_t n = x.size();
+  std::vector<double> ret(n, NA_REAL);
+  // Integral over [x_a, x_c], with neighbours x_l (for x_a) and x_r
+  // (for x_c) where present; l == a or r == c mark a missing one.
+  auto interval = [&] (size_t l, size_t a, size_t c, size_t r) -> double {
+    return integrate_interval_local(l != a, x[l], y[l], x[a], y[a],
+                                    x[c], y[c], r != c, x[r], y[r]);
+  };
+  for (size_t i = 1; i + 1 < n; ++i) {
+    const size_t l = i > 1 ? i - 2 : i - 1, r = i + 2 < n ? i + 2 : i + 1;
+    const double fine = interval(l, i - 1, i, i + 1) +
+      interval(i - 1, i, i + 1, r);
+    const double coarse = interval(l, i - 1, i + 1, r);
+    ret[i] = std::abs(fine - coarse) / scal;
+  }
+  return ret;
+}
+
 SEXP get_from_package(const std::string& name) {
   Rcpp::Environment pkg = Rcpp::Environment::namespace_env("plant");
   return pkg[name];
@@ -140,3 +166,21 @@ std::vector<double> local_error_integration(const std::vector<double>& x,
                                             double scal) {
   return plant::util::local_error_integration(x, y, scal);
 }
+
+// [[Rcpp::export]]
+double integrate_local_cubic(const std::vector<double>& x,
+                             const std::vector<double>& y) {
+  return plant::util::integrate_local_cubic(x, y);
+}
+
+// [[Rcpp::export]]
+std::vector<double> local_error_integration_cubic(const std::vector<double>& x,
+                                                  const std::vector<double>& y,
+                                                  double scal) {
+  return plant::util::local_error_integration_cubic(x, y, scal);
+}
+
+// [[Rcpp::export]]
+double test_ipow(double x, size_t n) {
+  return plant::util::ipow(x, n);
+}